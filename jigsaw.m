@@ -97,6 +97,10 @@ function [varargout] = jigsaw(opts)
 %       inement iterations. Set ITER=N to see progress after 
 %       N iterations. 
 %
+%   OPTS.MESH_BULK - {default=1} max. number of trias ref-
+%       ined per iteration. Trias with disjoint Delaunay 
+%       cavities are batched into one rDT update.
+%
 %   OPTS.MESH_TOP1 - {default=false} enforce 1-dim. topolog-
 %       ical constraints. 1-dim. edges are refined until all 
 %       embedded nodes are "locally 1-manifold", i.e. nodes 
@@ -138,6 +138,16 @@
      
         real_t                  _hfun_hmin ;
         
+    /* 
+    --------------------------------------------------------
+     * HFUN_DHDX - {default = +inf} max. gradient |dh/dx| 
+     * permitted in the mesh-size function. Enforced by 
+     * the MARCHE gradient-limiter; +inf disables limiting.
+    --------------------------------------------------------
+     */
+     
+        real_t                  _hfun_dhdx ;
+        
     /* 
     --------------------------------------------------------
      * BNDS_KERN - {default = 'bnd-tria'} placement of bou-
@@ -182,6 +192,17 @@
     
         indx_t                  _mesh_iter ;
        
+    /* 
+    --------------------------------------------------------
+     * MESH_BULK - {default = 1} max. number of trias ref-
+     * ined per iteration. Trias with disjoint Delaunay 
+     * cavities are batched into one rDT update. BULK=1 
+     * refines one tria at a time.
+    --------------------------------------------------------
+     */
+    
+        indx_t                  _mesh_bulk ;
+       
     /* 
     --------------------------------------------------------
      * MESH_TOP1 - {default=false} enforce 1-dim. topolog-
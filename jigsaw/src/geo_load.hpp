@@ -298,20 +298,11 @@
         try
         {
             jmsh_reader   _jmsh ;
-            std::ifstream _file ; 
-            _file. open(
-            _jcfg._geom_file, std::ifstream::in) ;
-
-            if (_file.is_open() )
-            {
-                _jmsh.read_file (
-                _file, geom_reader(&_geom));
-            }
-            else
+            if(!_jmsh.read_file (
+                _jcfg._geom_file, geom_reader(&_geom)))
             {           
                 _errv = __file_not_located ;
             }
-            _file.close ();
 
             for (auto _iter  = 
                       _jmsh._errs.head();
@@ -92,6 +92,18 @@
             this->
            _hfun->_kind = _kind ;
         }
+    /*-------------------------------- read RADII section */
+        __normal_call void_type push_radii (
+            double       *_erad
+            )
+        {
+            this->_hfun->_ellipsoid_grid_3d.
+                _radA = _erad[ 0] ;
+            this->_hfun->_ellipsoid_grid_3d.
+                _radB = _erad[ 1] ;
+            this->_hfun->_ellipsoid_grid_3d.
+                _radC = _erad[ 2] ;  
+        }
     /*-------------------------------- read NDIMS section */
         __normal_call void_type push_ndims (
             std:: size_t  _ndim
@@ -361,20 +373,11 @@
         try
         {
             jmsh_reader   _jmsh ;
-            std::ifstream _file ; 
-            _file. open(
-            _jcfg._hfun_file, std::ifstream::in) ;
-
-            if (_file.is_open() )
-            {
-                _jmsh.read_file (
-                _file, hfun_reader(&_hfun));
-            }
-            else
+            if(!_jmsh.read_file (
+                _jcfg._hfun_file, hfun_reader(&_hfun)))
             {           
                 _errv = __file_not_located ;
             }
-            _file.close ();
 
             for (auto _iter  = 
                       _jmsh._errs.head();
@@ -615,6 +618,26 @@
             _hfun._kind 
                 = jmsh_kind::ellipsoid_grid ;
             _hfun._ndim = +3;
+            
+            if (_hmsh._radii._size==+3)
+            {
+            _hfun._ellipsoid_grid_3d.
+                _radA = _hmsh._radii._data[0] ;
+            _hfun._ellipsoid_grid_3d.
+                _radB = _hmsh._radii._data[1] ;
+            _hfun._ellipsoid_grid_3d.
+                _radC = _hmsh._radii._data[2] ;
+            }
+            else
+            if (_hmsh._radii._size==+1)
+            {
+            _hfun._ellipsoid_grid_3d.
+                _radA = _hmsh._radii._data[0] ;
+            _hfun._ellipsoid_grid_3d.
+                _radB = _hmsh._radii._data[0] ;
+            _hfun._ellipsoid_grid_3d.
+                _radC = _hmsh._radii._data[0] ;
+            }
     
             for (auto _ipos = (size_t) +0 ;
                 _ipos != _hmsh._xgrid._size ; 
@@ -1146,6 +1169,46 @@
         return (  _errv ) ;
     }
     
+    /*
+    --------------------------------------------------------
+     * TEST-CLIP: check HFUN data is ok for MARCHE.
+    --------------------------------------------------------
+     */
+    
+    template <
+    typename      jlog_data
+             >
+    __normal_call iptr_type test_clip (
+        jcfg_data &_jcfg ,
+        jlog_data &_jlog ,
+        hfun_data &_hfun
+        )
+    {
+        iptr_type _errv  = __no_error ;
+
+        __unreferenced(_jcfg) ;
+
+        if (_hfun._kind ==
+             jmsh_kind::ellipsoid_grid)
+        {
+    /*--------------------------------- ellipsoid-grid-3d */
+            if (_hfun._ellipsoid_grid_3d.
+                _radA <= (real_type)  +0. ||
+                _hfun._ellipsoid_grid_3d.
+                _radB <= (real_type)  +0. ||
+                _hfun._ellipsoid_grid_3d.
+                _radC <= (real_type)  +0. )
+            {
+                _jlog.push (
+    "**input error: HFUN. RADII required for |dh/dx|.\n") ;
+        
+                _errv = __invalid_argument ;
+            }
+        }
+
+        return (  _errv ) ;
+    }
+    
     /*
     --------------------------------------------------------
      * ECHO-HFUN: print summary of HFUN data.
@@ -167,6 +167,13 @@
             this->
            _jjig->_hfun_hmin = _hmin; 
         }
+        __normal_call void_type push_hfun_dhdx (
+            double        _dhdx
+            ) 
+        {
+            this->
+           _jjig->_hfun_dhdx = _dhdx; 
+        }
     
     /*------------------------------------- INIT keywords */    
         __normal_call void_type push_init_file (
@@ -231,6 +238,13 @@
             this->_jjig->
            _rdel_opts.iter() = _iter;
         }
+        __normal_call void_type push_mesh_bulk (
+            std::int32_t  _bulk
+            ) 
+        { 
+            this->_jjig->
+           _rdel_opts.bulk() = _bulk;
+        }
         __normal_call void_type push_mesh_siz1 (
             double        _siz1
             ) 
@@ -484,6 +498,8 @@
             _hfun_hmax = _jjig._hfun_hmax ;
             _jcfg.
             _hfun_hmin = _jjig._hfun_hmin ;
+            _jcfg.
+            _hfun_dhdx = _jjig._hfun_dhdx ;
             
     /*------------------------------------- RDEL keywords */
             if (_jjig._mesh_kern == 
@@ -500,6 +516,8 @@
                 dims() = _jjig._mesh_dims ;
             _jcfg._rdel_opts.
                 iter() = _jjig._mesh_iter ;
+            _jcfg._rdel_opts.
+                bulk() = _jjig._mesh_bulk ;
                 
             _jcfg._rdel_opts.
                 top1() = _jjig._mesh_top1 ;
@@ -653,12 +671,20 @@
             _jcfg ._hfun_hmin , 
             (real_type)  0., 
         std::numeric_limits<real_type>::infinity())
+        __testREAL("HFUN-DHDX", 
+            _jcfg ._hfun_dhdx , 
+            (real_type)  0., 
+        std::numeric_limits<real_type>::infinity())
         
     /*---------------------------- test MESH keywords */
         __testINTS("MESH-ITER", 
             _jcfg._rdel_opts.iter(), 
             (iptr_type) + 0,
         std::numeric_limits<iptr_type>::     max())
+        __testINTS("MESH-BULK", 
+            _jcfg._rdel_opts.bulk(), 
+            (iptr_type) + 1,
+        std::numeric_limits<iptr_type>::     max())
 
         __testINTS("MESH-DIMS", 
             _jcfg._rdel_opts.dims(), 
@@ -868,6 +894,8 @@
             "HFUN-HMAX", _jcfg._hfun_hmax)
         __dumpREAL(
             "HFUN-HMIN", _jcfg._hfun_hmin)
+        __dumpREAL(
+            "HFUN-DHDX", _jcfg._hfun_dhdx)
 
         _jlog.push("\n") ;
         
@@ -899,6 +927,8 @@
 
         __dumpINTS("MESH-ITER", 
             _jcfg._rdel_opts.iter())
+        __dumpINTS("MESH-BULK", 
+            _jcfg._rdel_opts.bulk())
 
         __dumpINTS("MESH-DIMS", 
             _jcfg._rdel_opts.dims())
@@ -101,6 +101,9 @@
     __normal_call void_type push_hfun_hmin (
         double       /*_hmin*/
         ) { }
+    __normal_call void_type push_hfun_dhdx (
+        double       /*_dhdx*/
+        ) { }
         
     __normal_call void_type push_mesh_kern (
         std::int32_t /*_kern*/
@@ -114,6 +117,9 @@
     __normal_call void_type push_mesh_iter (
         std::int32_t /*_iter*/
         ) { }
+    __normal_call void_type push_mesh_bulk (
+        std::int32_t /*_bulk*/
+        ) { }
     __normal_call void_type push_mesh_siz1 (
         double       /*_siz1*/
         ) { }
@@ -426,6 +432,11 @@
             if (_stok[0] == "HFUN_HMIN")
                 {
             __putREAL(push_hfun_hmin, _stok) ;
+                }
+            else
+            if (_stok[0] == "HFUN_DHDX")
+                {
+            __putREAL(push_hfun_dhdx, _stok) ;
                 }          
             else
         /*---------------------------- read MESH keywords */
@@ -535,6 +546,11 @@
             __putINTS(push_mesh_iter, _stok) ;
                 }
             else
+            if (_stok[0] == "MESH_BULK")
+                {
+            __putINTS(push_mesh_bulk, _stok) ;
+                }
+            else
         /*---------------------------- read OPTM keywords */
             if (_stok[0] == "OPTM_ITER")
                 {
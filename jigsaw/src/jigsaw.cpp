@@ -209,6 +209,19 @@
 #   include <sstream>
 #   include <iostream>
 
+    /*---------------------------------- memory-map files */
+
+#   if  defined(__unix__) || defined(__APPLE__)
+#   define __use_mmap
+#   endif
+
+#   ifdef  __use_mmap
+#   include <fcntl.h>
+#   include <unistd.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   endif//__use_mmap
+
     /*---------------------------------- for ascii string */
     
 #   include <string>
@@ -225,6 +238,20 @@
 #   include <chrono>
 #   endif//__use_timers
 
+    /*---------------------------------- predicate counts */
+
+//  #   define __use_pred_stats     // opt-in, via -D flag
+
+    /*---------------------------------- multi-threading */
+
+#   ifdef  _OPENMP                    // via -fopenmp, etc
+#   define __use_openmp
+#   endif
+
+#   ifdef  __use_openmp
+#   include <omp.h>
+#   endif//__use_openmp
+
     /*---------------------------------- JIGSAW's backend */
 
 #   include "libcpp/libbasic.hpp"
@@ -335,6 +362,8 @@
             (real_type) +2.00E-02 ;
         real_type _hfun_hmin = 
             (real_type) +0.00E+00 ;
+        real_type _hfun_dhdx = 
+       +std::numeric_limits<real_type>::infinity() ;
 
     /*------------------------------- "low-level" config. */        
         typedef mesh::rdel_params <
@@ -484,6 +513,28 @@
            _ellipsoid_grid_3d.init() ;
         }
         
+    /*------------------------- helper: limit everything! */
+    
+        __normal_call void_type clip_hfun (
+            jcfg_data &_jcfg
+            )
+        {
+            this->_constant_value_kd.
+                clip(_jcfg._hfun_dhdx) ;
+        
+            this->_euclidean_mesh_2d.
+                clip(_jcfg._hfun_dhdx) ;
+            this->_euclidean_mesh_3d.
+                clip(_jcfg._hfun_dhdx) ;
+            
+            this->_euclidean_grid_2d.
+                clip(_jcfg._hfun_dhdx) ;
+            this->_euclidean_grid_3d.
+                clip(_jcfg._hfun_dhdx) ;
+            this->_ellipsoid_grid_3d.
+                clip(_jcfg._hfun_dhdx) ;
+        }
+        
         } ;
         
     /*
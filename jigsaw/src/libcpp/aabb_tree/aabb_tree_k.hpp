@@ -124,6 +124,31 @@
         public  :
         node_type           _node[ 2] ;
         } ;
+        
+    class split_data
+        { 
+    /*------------------------- a node's pending "split" */
+        public  :
+        iptr_type           _bdim;
+        bool_type           _push;
+    /*------------------------- "long" items kept at node */
+        item_data          *_pptr;
+        iptr_type           _pnum;
+    /*------------------------- new, un-linked children */
+        node_type           _lnod;
+        node_type           _rnod;
+        } ;
+        
+    class flat_node
+        { 
+    /*------------------------------- "frozen" node links */
+        public  :
+    /*------------------------------- contiguous item run */
+        iptr_type           _ipos;
+        iptr_type           _inum;
+    /*------------------------------- R-child, or -1 leaf */
+        iptr_type           _rpos;
+        } ;
 
 /*----------- two-layer pool'd allocator -- items + nodes */   
     typedef allocators::_pool_alloc<
@@ -143,6 +168,20 @@
     typedef containers::array      <      
                 node_ptrt,
                 allocator>              work_list ;
+                
+    typedef containers::array      <      
+                iptr_type,
+                allocator>              flat_work ;
+                
+    typedef containers::array      <      
+                flat_node,
+                allocator>              flat_list ;
+    typedef containers::array      <      
+                real_type,
+                allocator>              real_list ;
+    typedef containers::array      <      
+                item_data,
+                allocator>              item_list ;
 
     public  :
 /*------------------------------------- tree root pointer */
@@ -159,6 +198,15 @@
     node_pool              _node_pool ;
     item_pool              _item_pool ;
 
+/*------------------------------------- "frozen" layout: 
+    nodes in depth-first order, with the L-child at +1, 
+    boxes packed as {pmin, pmax} apart from the links, 
+    and each node's items in one contiguous run */
+    flat_list                   _flat ;
+    real_list                   _fbox ;
+    item_list                   _fitm ;
+    flat_work                   _fwrk ;
+
 /*------------------------------------- tree shape params */
     iptr_type                   _imax ;
     real_type                   _long ;
@@ -259,7 +307,12 @@
            _node_pool (
         wrap_pool(&_node_base))  ,
            _item_pool (
-        wrap_pool(&_item_base)) {}
+        wrap_pool(&_item_base))  ,
+    /*-------------------------------------- flat layout */
+            _flat(  _asrc) ,
+            _fbox(  _asrc) ,
+            _fitm(  _asrc) ,
+            _fwrk(  _asrc) {}
 
 /*----------------------------------------- default d'tor */
 
@@ -273,6 +326,10 @@
 
     __inline_call iptr_type count (
         ) const { return this->_size ; }
+        
+    __inline_call bool_type frozen (
+        ) const { return 
+              !this->_flat.empty() ; }
 
 /*------------- helper - find min-enclosing aabb for node */
     __static_call
@@ -426,6 +483,11 @@
         this->_root = &this->_rdat ;
 
         this->_size = +1 ;
+        
+    /*------------------------------ drop "frozen" layout */
+        this->_flat.clear() ;
+        this->_fbox.clear() ;
+        this->_fitm.clear() ;
 
     /*------------------------------ set node fill params */
         this->_imax = _imax ;
@@ -460,160 +522,353 @@
             push_tail(this->_root);
         
     /*--- refine tree until all nodes satisfy constraints */
+#       ifdef  __use_openmp
+        if (omp_get_max_threads() > +1)
+        {
+            load_wave() ; return ;
+        }
+#       endif//__use_openmp
+
         for( ; !this->_work.empty() ; )
         {
             node_type *_pnod = nullptr;
-            node_data *_ndat = nullptr;
-            node_type *_rnod = nullptr;
-            node_type *_lnod = nullptr;
-            
-            real_type  _blen ;      
-            iptr_type  _bdim = -1 ;
-            iptr_type  _pnum = +0 ;
-            iptr_type  _cnum = +0 ;
-            iptr_type  _lnum = +0 ;
-            iptr_type  _rnum = +0 ;
-            
-            item_data *_next = nullptr;
-            item_data *_pptr = nullptr;
-            item_data *_cptr = nullptr;
-            item_data *_lptr = nullptr;
-            item_data *_rptr = nullptr;
-            
+            split_data _sdat ;
+        
         /*-------------------------- _pop node from stack */
             this->_work._pop_tail(_pnod) ;
 
-        /*---------- find best "split" axis for this node */
-            find_best_axis (_pnod, _bdim , 
-                            _blen) ;
-            
-            if (_bdim == -1) continue ;
-                   
-        /*---------- partition list - remove "long" items */
-            for(item_data *_iptr  = _pnod->
-                                    _hptr ; 
-                           _iptr != nullptr ; 
-                           _iptr  = _next )
-            {
-                _next = _iptr->_next ;
-        /*------------------------------- partition items */
-                if (_iptr->_data
-                    .plen (_bdim) > _blen)
-                {
-                    push_item(_pptr,_iptr);
-                   _pnum += +1 ;
-                }
-                else
-                {
-                    push_item(_cptr,_iptr); 
-                   _cnum += +1 ;
-                }
-            }
-        
-        /*---------- split pos. - mean of non-long aabb's */
-            real_type _spos = (real_type)+0.;
+            split_node(_pnod, _sdat) ;
+            link_split(_pnod, _sdat) ;
+        }
+    }
+    
+#   ifdef  __use_openmp
+
+/*--- refine tree as a sequence of "waves": nodes pending
+    in the work-list are split in parallel, and are then
+    linked in serially. Each split depends only upon the
+    node's own item list, so the tree is the same as the
+    serial build, irrespective of thread count */
+    __normal_call void_type load_wave (
+        )
+    {
+        work_list _wave ;
+        containers::array<split_data> _sset ;
+    
+        for( ; !this->_work.empty() ; )
+        {
+            _wave.set_count( +0) ;
+            _wave.push_tail(this->_work.head(), 
+                            this->_work.tend()) ;
+            
+            this->_work.set_count( +0) ;
+            
+            iptr_type _last = 
+                (iptr_type)_wave.count() ;
             
-            for(item_data *_iptr  = _cptr ; 
-                           _iptr != nullptr ; 
-                           _iptr  = _next )
+            _sset.set_count(_last) ;
+        
+        /*-------------------------- split nodes in || */
+            #pragma omp parallel for schedule(dynamic, +1)
+            for (iptr_type _ipos = +0; 
+                    _ipos < _last; ++_ipos)
             {
-                _next = _iptr->_next ;
-         
-                _spos +=_iptr->
-                        _data.pmid (_bdim);
+                split_node(
+                    _wave[_ipos], _sset[_ipos]) ;
             }
             
-            _spos  = _spos / _cnum ;
-  
-        /*---------- partition list - split on left|right */
-            for(item_data *_iptr  = _cptr ; 
-                           _iptr != nullptr ; 
-                           _iptr  = _next )
-            {
-                _next = _iptr->_next ;
-        /*------------------------------- partition items */
-                if (_iptr->_data
-                    .pmid (_bdim) > _spos)
-                {
-                    push_item(_rptr,_iptr); 
-                   _rnum += +1 ;
-                }
-                else
-                {
-                    push_item(_lptr,_iptr); 
-                   _lnum += +1 ;
-                }
+        /*-------------------------- push nodes serially */
+            for (iptr_type _ipos = +0; 
+                    _ipos < _last; ++_ipos)
+            {
+                link_split(
+                    _wave[_ipos], _sset[_ipos]) ;
             }
+        }
+    }
+    
+#   endif//__use_openmp
+
+/*------------- helper - partition items + child aabb's */
+    __normal_call void_type split_node (
+        node_type  *_pnod ,
+        split_data &_sdat
+        )
+    {
+        real_type  _blen = +0. ;
+        iptr_type  _cnum = +0 ;
+        iptr_type  _lnum = +0 ;
+        iptr_type  _rnum = +0 ;
         
-        /*-------------------- alloc. new child node data */
-            make_node(_ndat);
-            _lnod = &_ndat->_node[ 0] ;
-            _rnod = &_ndat->_node[ 1] ;
-            
-            this->_size  += +2 ;
-            
-            _pnod->_hptr  = _pptr ;
-            _pnod->_size  = _pnum ;
-            _pnod->_lptr  = _ndat ;
-            
-            _lnod->_hptr  = _lptr ;
-            _lnod->_size  = _lnum ;
-            _lnod->_lptr  = nullptr ;
-            _lnod->_pptr  = _pnod ;
-            
-            _rnod->_hptr  = _rptr ;
-            _rnod->_size  = _rnum ;
-            _rnod->_lptr  = nullptr ;
-            _rnod->_pptr  = _pnod ;
+        item_data *_next = nullptr;
+        item_data *_pptr = nullptr;
+        item_data *_cptr = nullptr;
+        item_data *_lptr = nullptr;
+        item_data *_rptr = nullptr;
         
-            init_aabb_node (_lnod, _pnod);
-            init_aabb_node (_rnod, _pnod);
-            
-        /*------------------ push new children onto stack */
-            if (_cnum < this->_imax)
-            {       
-                real_type _volp, _voll, _volr ;
+        _sdat._bdim = -1 ;
+        _sdat._push = false ;
+        _sdat._pptr = nullptr ;
+        _sdat._pnum = +0 ;
+
+    /*-------------- find best "split" axis for this node */
+        find_best_axis (_pnod, _sdat._bdim, 
+                        _blen) ;
         
-                _volp = (real_type) +1. ;
-                _voll = (real_type) +1. ;
-                _volr = (real_type) +1. ;
+        if (_sdat._bdim == -1) return ;
         
-                for (auto _idim = _dims; _idim-- != +0; )
-                {
-        /*--------------- parent // child (hyper) volumes */
-                    _volp *= 
-                    _pnod->_pmax[_idim] - 
-                    _pnod->_pmin[_idim] ;
-                             
-                    _voll *= 
-                    _lnod->_pmax[_idim] - 
-                    _lnod->_pmin[_idim] ;
-                             
-                    _volr *= 
-                    _rnod->_pmax[_idim] - 
-                    _rnod->_pmin[_idim] ;
-                }
+        iptr_type  _bdim = _sdat._bdim ;
+               
+    /*-------------- partition list - remove "long" items */
+        for(item_data *_iptr  = _pnod->
+                                _hptr ; 
+                       _iptr != nullptr ; 
+                       _iptr  = _next )
+        {
+            _next = _iptr->_next ;
+    /*----------------------------------- partition items */
+            if (_iptr->_data
+                .plen (_bdim) > _blen)
+            {
+                push_item(_pptr,_iptr);
+               _sdat._pnum += +1 ;
+            }
+            else
+            {
+                push_item(_cptr,_iptr); 
+               _cnum += +1 ;
+            }
+        }
+    
+    /*-------------- split pos. - mean of non-long aabb's */
+        real_type _spos = (real_type)+0.;
         
-                if (_voll + _volr <= this->_vtol * _volp)
-                {
-        /*--------------- push children due to vol. ratio */
-                    this->_work
-                       .push_tail(_rnod);
-                    this->_work
-                       .push_tail(_lnod);
-                }
-                
+        for(item_data *_iptr  = _cptr ; 
+                       _iptr != nullptr ; 
+                       _iptr  = _next )
+        {
+            _next = _iptr->_next ;
+     
+            _spos +=_iptr->
+                    _data.pmid (_bdim);
+        }
+        
+        _spos  = _spos / _cnum ;
+
+    /*-------------- partition list - split on left|right */
+        for(item_data *_iptr  = _cptr ; 
+                       _iptr != nullptr ; 
+                       _iptr  = _next )
+        {
+            _next = _iptr->_next ;
+    /*----------------------------------- partition items */
+            if (_iptr->_data
+                .pmid (_bdim) > _spos)
+            {
+                push_item(_rptr,_iptr); 
+               _rnum += +1 ;
             }
             else
             {
-        /*--------------- push children due to items cap. */
-                    this->_work
-                       .push_tail(_rnod);
-                    this->_work
-                       .push_tail(_lnod);         
+                push_item(_lptr,_iptr); 
+               _lnum += +1 ;
             }
         }
     
+    /*------------------------ new children, not yet linked */
+        node_type *_lnod = &_sdat._lnod ;
+        node_type *_rnod = &_sdat._rnod ;
+        
+        _sdat._pptr   = _pptr ;
+        
+        _lnod->_hptr  = _lptr ;
+        _lnod->_size  = _lnum ;
+        _lnod->_lptr  = nullptr ;
+        _lnod->_pptr  = _pnod ;
+        
+        _rnod->_hptr  = _rptr ;
+        _rnod->_size  = _rnum ;
+        _rnod->_lptr  = nullptr ;
+        _rnod->_pptr  = _pnod ;
+    
+        init_aabb_node (_lnod, _pnod);
+        init_aabb_node (_rnod, _pnod);
+        
+    /*---------------------- push new children onto stack */
+        if (_cnum < this->_imax)
+        {       
+            real_type _volp, _voll, _volr ;
+    
+            _volp = (real_type) +1. ;
+            _voll = (real_type) +1. ;
+            _volr = (real_type) +1. ;
+    
+            for (auto _idim = _dims; _idim-- != +0; )
+            {
+    /*------------------- parent // child (hyper) volumes */
+                _volp *= 
+                _pnod->_pmax[_idim] - 
+                _pnod->_pmin[_idim] ;
+                         
+                _voll *= 
+                _lnod->_pmax[_idim] - 
+                _lnod->_pmin[_idim] ;
+                         
+                _volr *= 
+                _rnod->_pmax[_idim] - 
+                _rnod->_pmin[_idim] ;
+            }
+    
+    /*------------------- push children due to vol. ratio */
+            _sdat._push = 
+           (_voll + _volr <= this->_vtol * _volp) ;
+        }
+        else
+        {
+    /*------------------- push children due to items cap. */
+            _sdat._push = true ;
+        }
+    }
+    
+/*------------- helper - alloc. + link a node's children */
+    __normal_call void_type link_split (
+        node_type  *_pnod ,
+        split_data &_sdat
+        )
+    {
+        if (_sdat._bdim == -1) return ;
+    
+        node_data *_ndat = nullptr;
+        make_node(_ndat);
+        
+        node_type *_lnod = &_ndat->_node[ 0] ;
+        node_type *_rnod = &_ndat->_node[ 1] ;
+        
+       *_lnod = _sdat._lnod ;
+       *_rnod = _sdat._rnod ;
+        
+        this->_size  += +2 ;
+        
+        _pnod->_hptr  = _sdat._pptr ;
+        _pnod->_size  = _sdat._pnum ;
+        _pnod->_lptr  = _ndat ;
+        
+        if (_sdat._push)
+        {
+            this->_work.push_tail(_rnod);
+            this->_work.push_tail(_lnod);
+        }
+    }
+    
+/*-------- repack tree into a flat, cache-linear "frozen" 
+    layout, releasing the pointer-linked nodes + items */
+    __normal_call void_type freeze (
+        )
+    {
+        class flat_push
+            {
+    /*------------------ helper: node + its parent's slot */
+            public  :
+                node_type      *_node ;
+                iptr_type       _ppos ;
+            } ;
+    
+        if (this->_root == nullptr) return ;
+        if (this->frozen()) return ;
+        
+        containers::array<flat_push> _wstk ;
+        
+        this->_flat.set_count(+0) ;
+        this->_fbox.set_count(+0) ;
+        this->_fitm.set_count(+0) ;
+        
+        this->_flat.set_alloc(this->_size) ;
+        this->_fbox.set_alloc(
+            this->_size * _dims * 2) ;
+        
+        flat_push _push ;
+        _push._node = this->_root ;
+        _push._ppos = -1 ;
+        _wstk.push_tail(_push) ;
+        
+    /*--------------------- depth-first, L-child at +1 */
+        for ( ; !_wstk.empty() ; )
+        {
+            _wstk._pop_tail(_push) ;
+            
+            node_type *_node = _push._node ;
+            
+            iptr_type  _npos = 
+           (iptr_type) this->_flat.count() ;
+            
+            if (_push._ppos >= +0)
+            this->_flat[_push._ppos]._rpos = _npos ;
+            
+            flat_node  _fdat ;
+            _fdat._ipos = 
+           (iptr_type) this->_fitm.count() ;
+            _fdat._inum = +0 ;
+            _fdat._rpos = -1 ;
+            
+            for (auto _idim = +0; 
+                _idim < _dims; ++_idim)
+            this->_fbox.push_tail(
+                _node->_pmin[_idim]) ;
+            
+            for (auto _idim = +0; 
+                _idim < _dims; ++_idim)
+            this->_fbox.push_tail(
+                _node->_pmax[_idim]) ;
+                
+        /*--------------------- copy items, in list order */
+            for (item_data *_iptr  = 
+                    _node->_hptr ; 
+                            _iptr != nullptr ; 
+                    _iptr  = _iptr->_next )
+            {
+                this->_fitm.push_tail(
+                    item_data(nullptr, 
+                        _iptr->_data)) ;
+                        
+                _fdat._inum += +1 ;
+            }
+            
+            this->_flat.push_tail(_fdat) ;
+            
+            if (_node->lower(0) != nullptr)
+            {
+                _push._node = _node->lower(1) ;
+                _push._ppos = _npos ;
+                _wstk.push_tail(_push) ;
+                
+                _push._node = _node->lower(0) ;
+                _push._ppos = -1 ;
+                _wstk.push_tail(_push) ;
+            }
+        }
+        
+    /*--------------------- re-link items within each run */
+        for (auto _iter  = this->_flat.head() ;
+                  _iter != this->_flat.tend() ;
+                ++_iter  )
+        {
+            for (auto _ipos = +1 ; 
+                _ipos < _iter->_inum; ++_ipos)
+            {
+                this->_fitm[
+            _iter->_ipos+_ipos-1]._next = 
+               &this->_fitm[
+            _iter->_ipos+_ipos-0] ;
+            }
+        }
+        
+    /*--------------------- release pointer-linked tree, 
+                            BRIO needs a non-frozen tree */
+        this->_rdat._hptr = nullptr ;
+        this->_rdat._lptr = nullptr ;
+        
+        this->_node_base.clear() ;
+        this->_item_base.clear() ;
     }
     
 /*-------- form a biased, spatially-local insertion order */    
@@ -750,20 +1005,31 @@
     {
         if (this->_root == nullptr) return false ;
 
+        if (this->frozen())
+            return find_flat(_pred, _fout) ;
+
     /*----------------- maintain stack of unvisited nodes */
-        this->_work.set_count( +0) ;
+#       ifdef  __use_openmp
+        work_list  _wloc ;  // re-entrant if called in ||
+        work_list &_wstk = 
+            omp_in_parallel() ? _wloc : this->_work ;
+#       else
+        work_list &_wstk = this->_work ;
+#       endif//__use_openmp
+
+        _wstk.set_count( +0) ;
         if (_pred(this->_root->_pmin,
                   this->_root->_pmax)
                  )
-        this->_work.
+        _wstk.
             push_tail(this->_root) ;
 
     /*----------------- traverse while _pred remains true */
         bool_type _find =  false ;
-        for ( ; !this->_work.empty() ; )
+        for ( ; !_wstk.empty() ; )
         {
             node_type *_node = nullptr ;
-            this->_work.
+            _wstk.
                 _pop_tail(_node) ;
 
             if (_node->_hptr!= nullptr )
@@ -780,14 +1046,14 @@
                 _node->lower(0)->_pmin ,
                 _node->lower(0)->_pmax )
                      )
-            this->_work.push_tail (
+            _wstk.push_tail (
                   _node->lower(0)) ;
                   
             if (_pred(
                 _node->lower(1)->_pmin ,
                 _node->lower(1)->_pmax )
                      )
-            this->_work.push_tail (
+            _wstk.push_tail (
                   _node->lower(1)) ;
             }
         }
@@ -795,6 +1061,268 @@
         return ( _find ) ;
     }
     
+/*-------- search "frozen" layout via aabb traversal; the 
+    visit order matches FIND on the pointer-linked tree */
+    template <
+    typename      tree_pred ,// tree intersections
+    typename      item_pred  // item intersections
+             >
+    __normal_call bool_type find_flat (
+        tree_pred &_pred,
+        item_pred &_fout
+        )
+    {
+    /*----------------- maintain stack of unvisited nodes */
+#       ifdef  __use_openmp
+        flat_work  _wloc ;  // re-entrant if called in ||
+        flat_work &_wstk = 
+            omp_in_parallel() ? _wloc : this->_fwrk ;
+#       else
+        flat_work &_wstk = this->_fwrk ;
+#       endif//__use_openmp
+
+        real_type *_fbox = &this->_fbox[0] ;
+
+        _wstk.set_count( +0) ;
+        if (_pred(_fbox + 0 , 
+                  _fbox + _dims) )
+        _wstk.push_tail( +0) ;
+
+    /*----------------- traverse while _pred remains true */
+        bool_type _find =  false ;
+        for ( ; !_wstk.empty() ; )
+        {
+            iptr_type  _npos = -1 ;
+            _wstk.
+                _pop_tail(_npos) ;
+                
+            flat_node &_node = 
+                this->_flat[_npos] ;
+
+            if (_node._inum != +0 )
+            {
+                _find = true ;
+        /*-------------------- leaf: push onto output */
+                _fout(&this->
+                    _fitm[_node._ipos]) ;
+            }
+
+            if (_node._rpos != -1 )
+            {
+        /*-------------------- traverse into children */
+            iptr_type _lpos = _npos + 1 ;
+            iptr_type _rpos = _node._rpos ;
+            
+            if (_pred(
+                _fbox + _lpos*_dims*2 + 0 ,
+                _fbox + _lpos*_dims*2 + _dims)
+                     )
+            _wstk.push_tail (_lpos) ;
+                  
+            if (_pred(
+                _fbox + _rpos*_dims*2 + 0 ,
+                _fbox + _rpos*_dims*2 + _dims)
+                     )
+            _wstk.push_tail (_rpos) ;
+            }
+        }
+        
+        return ( _find ) ;
+    }
+    
+/*-------- search for a set of queries as 32-wide packets: 
+    each packet is traversed together, so that each node
+    is visited once per packet, with its aabb tested vs. 
+    all queries still active. Per-query visit order is 
+    as per FIND, and large sets are split over threads. 
+    The I-th query calls _FOUT[I] on its matching items,
+    so item preds must be independent of each other */
+    template <
+    typename      tree_pred ,// tree intersections
+    typename      item_pred  // item intersections
+             >
+    __normal_call bool_type find (
+        iptr_type  _npck,
+        tree_pred *_pred,
+        item_pred *_fout
+        )
+    {
+        iptr_type static constexpr _PMAX = +32 ;
+    
+        if (this->_root == nullptr) return false ;
+        
+        bool_type _find = false ;
+
+        if (!this->frozen())
+        {
+    /*----------------- linked layout: query one-by-one */
+            for (auto _ipos = +0; 
+                _ipos < _npck; ++_ipos)
+            {
+                if (find(_pred[_ipos],
+                         _fout[_ipos])) 
+                    _find = true ;
+            }
+            
+            return ( _find ) ;
+        }
+
+        iptr_type _last = 
+            (_npck + _PMAX - 1) / _PMAX ;
+        
+#       ifdef  __use_openmp
+        if (_last > +4 && 
+            omp_get_max_threads() > +1 &&
+           !omp_in_parallel() )
+        {
+    /*----------------- large set: one packet per thread */
+            #pragma omp parallel for schedule(dynamic, +1) \
+                reduction(||: _find)
+            for (iptr_type _ipck = +0; 
+                    _ipck < _last; ++_ipck)
+            {
+                iptr_type _ioff = _ipck * _PMAX ;
+            
+                if (find_pack(
+                    std::min(_npck-_ioff, _PMAX),
+                    _pred + _ioff, 
+                    _fout + _ioff)) _find = true ;
+            }
+            
+            return ( _find ) ;
+        }
+#       endif//__use_openmp
+
+        for (iptr_type _ipck = +0; 
+                _ipck < _last; ++_ipck)
+        {
+            iptr_type _ioff = _ipck * _PMAX ;
+        
+            if (find_pack(
+                std::min(_npck-_ioff, _PMAX),
+                _pred + _ioff, 
+                _fout + _ioff)) _find = true ;
+        }
+        
+        return ( _find ) ;
+    }
+    
+/*-------- helper: index of lowest set bit, via de Bruijn */
+    __static_call
+    __inline_call iptr_type low_bit (
+        uint32_t  _mask
+        )
+    {
+        static const iptr_type _bpos[32] = {
+         0,  1, 28,  2, 29, 14, 24,  3, 
+        30, 22, 20, 15, 25, 17,  4,  8, 
+        31, 27, 13, 23, 21, 19, 16,  7, 
+        26, 12, 18,  6, 11,  5, 10,  9 
+            } ;
+            
+        return _bpos[((_mask & (0u-_mask)) * 
+            0x077CB531u) >> 27] ;
+    }
+    
+/*-------- search "frozen" layout for a packet of queries */
+    template <
+    typename      tree_pred ,// tree intersections
+    typename      item_pred  // item intersections
+             >
+    __normal_call bool_type find_pack (
+        iptr_type  _npck,
+        tree_pred *_pred,
+        item_pred *_fout
+        )
+    {
+        class pack_node
+            {
+    /*--------------------- node + bit-mask of queries */
+            public  :
+                iptr_type       _npos ;
+                uint32_t        _mask ;
+            } ;
+    
+        containers::array<pack_node> _wstk ;
+
+        real_type *_fbox = &this->_fbox[0] ;
+
+        pack_node  _pack ;
+        _pack._npos = +0 ;
+        _pack._mask = +0 ;
+
+        for (auto _ipos = +0; 
+            _ipos < _npck; ++_ipos)
+        {
+            if (_pred[_ipos](_fbox + 0 , 
+                             _fbox + _dims) )
+            _pack._mask |= 1u << _ipos ;
+        }
+
+        if (_pack._mask != +0)
+        _wstk.push_tail(_pack) ;
+
+    /*----------------- traverse while _pred remains true */
+        bool_type _find =  false ;
+        for ( ; !_wstk.empty() ; )
+        {
+            _wstk._pop_tail(_pack) ;
+                
+            flat_node &_node = 
+                this->_flat[_pack._npos] ;
+
+            if (_node._inum != +0 )
+            {
+                _find = true ;
+        /*-------------------- leaf: push onto output */
+                for (uint32_t _mask  = _pack._mask; 
+                              _mask != +0 ; 
+                              _mask &= _mask - 1)
+                {
+                    _fout[low_bit(_mask)](&this->
+                        _fitm[_node._ipos]) ;
+                }
+            }
+
+            if (_node._rpos != -1 )
+            {
+        /*-------------------- traverse into children */
+            pack_node _lpck, _rpck ;
+            _lpck._npos = _pack._npos + 1 ;
+            _lpck._mask = +0 ;
+            _rpck._npos = _node._rpos ;
+            _rpck._mask = +0 ;
+            
+            real_type *_lbox = 
+                _fbox + _lpck._npos*_dims*2 ;
+            real_type *_rbox = 
+                _fbox + _rpck._npos*_dims*2 ;
+            
+            for (uint32_t _mask  = _pack._mask; 
+                          _mask != +0 ; 
+                          _mask &= _mask - 1)
+            {
+                iptr_type _ipos = low_bit(_mask) ;
+            
+                if (_pred[_ipos](
+                    _lbox, _lbox + _dims))
+                _lpck._mask |= 1u << _ipos ;
+                
+                if (_pred[_ipos](
+                    _rbox, _rbox + _dims))
+                _rpck._mask |= 1u << _ipos ;
+            }
+            
+            if (_lpck._mask != +0)
+                _wstk.push_tail (_lpck) ;
+            if (_rpck._mask != +0)
+                _wstk.push_tail (_rpck) ;
+            }
+        }
+        
+        return ( _find ) ;
+    }
+    
 /*-------- check for nearsest in collection via traversal */
     __normal_call bool_type near (
         real_type *_ppos ,
@@ -827,6 +1355,9 @@
     
         if (this->_root 
                 == nullptr) return _find;
+                
+        if (this->frozen())
+            return near_flat(_ppos, _near) ;
   
         real_type _dist = 
             +std::numeric_limits
@@ -917,6 +1448,128 @@
         return ( _find )  ;        
     }
     
+/*-------- check for nearest in "frozen" layout, as NEAR */
+    __normal_call bool_type near_flat (
+        real_type *_ppos ,
+        item_data*&_near
+        )
+    {
+        class node_dist
+            {
+    /*----------------------------- node/dist type for PQ */
+            public  :
+                real_type       _dist ;
+                iptr_type       _npos ;
+            } ;
+            
+        class node_pred
+            {
+    /*----------------------------- node/dist less for PQ */
+            public  :
+            __inline_call 
+                bool_type operator () (
+                node_dist const&_adat ,
+                node_dist const&_bdat
+                ) const
+            {   return ( _adat. _dist <
+                         _bdat. _dist ) ;
+            }
+            } ;
+    
+        bool_type _find = false;
+  
+        real_type _dist = 
+            +std::numeric_limits
+                <real_type>::infinity() ;
+        
+        real_type _dloc = 
+            -std::numeric_limits
+                <real_type>::infinity() ;
+                
+        real_type *_fbox = &this->_fbox[0] ;
+
+    /*----------------- maintain stack of unvisited nodes */
+        containers::priorityset<
+            node_dist ,
+            node_pred    > _nnpq ;
+    
+        node_dist _ndat ;
+        _ndat._npos = +0 ;
+        _ndat._dist = 
+        calc_rect_dist(_ppos ,
+            _fbox + 0, _fbox + _dims) ;
+        _nnpq.push    (_ndat);
+        
+    /*----------------- traverse tree while len. reducing */
+        for ( ; !_nnpq.empty()  ; )
+        {
+        /*------------------------ test next closest node */
+            _nnpq._pop_root (_ndat) ;
+
+            if (_ndat._dist<=_dist)
+            {
+        /*------------------------ descend if maybe close */
+            flat_node &_node = 
+                this->_flat[_ndat._npos] ;
+            
+            if (_node._inum != +0 )
+            {
+        /*------------------------ leaf: update item-dist */
+                for (auto _ipos = _node._ipos ;
+                          _ipos < _node._ipos + 
+                                  _node._inum ;
+                        ++_ipos )
+                {
+                    item_data *_iptr = 
+                        &this->_fitm[_ipos] ;
+                
+                    _dloc = 
+                    calc_rect_dist(_ppos ,
+                   &_iptr->_data.pmin(0) ,
+                   &_iptr->_data.pmax(0)
+                        ) ;
+                  
+                    if (_dloc < _dist)
+                    {
+                /*---------------- keep track of min-len. */
+                        _dist = _dloc;
+                        _near = _iptr;
+                    }
+                }
+
+                _find =  true ;
+            }
+
+            if (_node._rpos != -1 )
+            {
+        /*------------------------ traverse into children */
+                iptr_type _lpos = 
+                    _ndat._npos + 1 ;
+                iptr_type _rpos = 
+                    _node._rpos ;
+                
+                _ndat._npos =  _lpos ;
+                _ndat._dist = 
+                calc_rect_dist(_ppos ,
+                    _fbox + _lpos*_dims*2 + 0 ,
+                    _fbox + _lpos*_dims*2 + _dims) ;
+                _nnpq.push(_ndat)  ;
+                
+                _ndat._npos =  _rpos ;
+                _ndat._dist = 
+                calc_rect_dist(_ppos ,
+                    _fbox + _rpos*_dims*2 + 0 ,
+                    _fbox + _rpos*_dims*2 + _dims) ;
+                _nnpq.push(_ndat)  ;
+            }
+            
+            }
+        }
+
+    /*---------------------------- must have found a node */
+        return ( _find )  ;        
+    }
+    
     } ;
 
     
@@ -50,6 +50,8 @@
 
 #   include "algorithms/sort.hpp"
 #   include "algorithms/find.hpp"
+#   include "algorithms/random.hpp"
+#   include "algorithms/hilbert.hpp"
 
 
 #   endif//__ALGORITHMS__
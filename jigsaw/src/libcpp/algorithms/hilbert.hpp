@@ -0,0 +1,334 @@
+    /*
+    --------------------------------------------------------
+     * HILBERT: keys along a space-filling Hilbert curve.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __HILBERT__
+#   define __HILBERT__
+
+#   include <cstdint>
+#   include <limits>
+#   include <algorithm>
+
+    namespace algorithms {
+
+    /*
+    --------------------------------------------------------
+     * HILBERT-KEY: index of a point along a k-dim. curve.
+    --------------------------------------------------------
+     * NDIM - number of dimensions, 1 <= NDIM <= 3.
+     * PPOS - (NDIM) point coordinates.
+     * PMIN - (NDIM) lower corner of bounding-box.
+     * PMAX - (NDIM) upper corner of bounding-box.
+    --------------------------------------------------------
+     * The box is quantised onto a 2^B grid per axis, with
+     * B*NDIM <= 63, and the key is formed via Skilling's
+     * transpose (AIP Conf. Proc. 707, 2004). Points that
+     * are close in key are close in space, so sorting by
+     * key gives a cache-friendly storage order.
+    --------------------------------------------------------
+     */
+
+    template <
+    typename  real_type
+             >
+    __normal_call std::uint64_t hilbert_key (
+        std::size_t      _ndim ,
+        real_type const* _ppos ,
+        real_type const* _pmin ,
+        real_type const* _pmax
+        )
+    {
+        std::size_t static constexpr
+            KMAX = +3 ;
+
+        std::uint32_t _xpos[KMAX] ;
+
+        std::uint32_t _bits =
+            (std::uint32_t)(63 / _ndim) ;
+        std::uint32_t _bmax =
+            (std::uint32_t)(31) ;
+        if (_bits > _bmax) _bits = _bmax ;
+
+    /*----------------------- quantise onto integer grid */
+        double _xmax = (double)
+            ((std::uint32_t(1) << _bits) - 1) ;
+
+        for (auto _idim = _ndim; _idim-- != 0; )
+        {
+            double _xlen = (double)
+                (_pmax[_idim] - _pmin[_idim]);
+            double _xrel = _xlen > 0. ? (double)
+                (_ppos[_idim] - _pmin[_idim])
+                    / _xlen : 0. ;
+
+            if (_xrel < 0.) _xrel = 0. ;
+            if (_xrel > 1.) _xrel = 1. ;
+
+            _xpos[_idim] =
+                (std::uint32_t)(_xrel * _xmax) ;
+        }
+
+    /*----------------------- axes-to-transpose, inverse */
+        std::uint32_t _mbit =
+            std::uint32_t(1) << (_bits - 1) ;
+
+        for (auto _qbit = _mbit;
+                  _qbit > +1; _qbit >>= 1)
+        {
+            std::uint32_t _pbit = _qbit - 1 ;
+
+            for (auto _idim = +0u;
+                _idim != _ndim; ++_idim)
+            {
+                if (_xpos[_idim] & _qbit)
+                {
+                    _xpos[0] ^= _pbit ;
+                }
+                else
+                {
+                    std::uint32_t _swap =
+                   (_xpos[0] ^ _xpos[_idim]) & _pbit ;
+
+                    _xpos[    0] ^= _swap ;
+                    _xpos[_idim] ^= _swap ;
+                }
+            }
+        }
+
+    /*----------------------- gray-encode the transpose */
+        for (auto _idim = +1u;
+            _idim  < _ndim; ++_idim)
+        {
+            _xpos[_idim] ^= _xpos[_idim-1] ;
+        }
+
+        std::uint32_t _tbit = +0 ;
+        for (auto _qbit = _mbit;
+                  _qbit > +1; _qbit >>= 1)
+        {
+            if (_xpos[_ndim-1] & _qbit)
+                _tbit ^= _qbit - 1 ;
+        }
+
+        for (auto _idim = +0u;
+            _idim != _ndim; ++_idim)
+        {
+            _xpos[_idim] ^= _tbit ;
+        }
+
+    /*----------------------- interleave into 64-bit key */
+        std::uint64_t _hkey = +0 ;
+        for (auto _ibit = _bits; _ibit-- != 0; )
+        {
+            for (auto _idim = +0u;
+                _idim != _ndim; ++_idim)
+            {
+                _hkey = (_hkey << 1) |
+               ((_xpos[_idim] >> _ibit) & 1u) ;
+            }
+        }
+
+        return ( _hkey ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * BRIO-RANK: round index for randomised insertion.
+    --------------------------------------------------------
+     * A (deterministic) hash of IPOS, where round R is
+     * taken with probability 1/2^(R+1), so that each round
+     * is roughly half the size of the one that follows.
+    --------------------------------------------------------
+     */
+
+    __inline_call std::uint32_t brio_rank (
+        std::uint32_t _ipos
+        )
+    {
+        std::uint32_t _hval = _ipos + 0x9e3779b9u ;
+
+    /*----------------------- murmur3 32-bit finaliser */
+        _hval ^= _hval >> 16 ;
+        _hval *= 0x85ebca6bu ;
+        _hval ^= _hval >> 13 ;
+        _hval *= 0xc2b2ae35u ;
+        _hval ^= _hval >> 16 ;
+
+        std::uint32_t _rank = +0 ;
+        for ( ; (_hval & 1u) != 0 &&
+                 _rank < 31; _hval >>= 1)
+        {
+            _rank += +1 ;
+        }
+
+        return ( _rank ) ;
+    }
+
+    template <
+    typename  iptr_type
+             >
+    class brio_item
+        {
+        public  :
+        std::uint64_t           _hkey ;
+        std::uint32_t           _rank ;
+        iptr_type               _ipos ;
+        } ;
+
+    class brio_less
+        {
+    /*--- rounds high-to-low, curve dir. alternates so
+          that each round starts near where the last one
+          left off */
+        public  :
+        template <
+        typename  item_type
+                 >
+        __inline_call bool_type operator() (
+            item_type const&_idat ,
+            item_type const&_jdat
+            ) const
+        {
+            if (_idat._rank != _jdat._rank)
+                return _idat._rank > _jdat._rank ;
+
+            if (_idat._hkey != _jdat._hkey)
+                return (_idat._rank % 2 == 0) ?
+                    _idat._hkey < _jdat._hkey :
+                    _idat._hkey > _jdat._hkey ;
+
+            return _idat._ipos < _jdat._ipos ;
+        }
+        } ;
+
+    /*
+    --------------------------------------------------------
+     * BRIO-SORT: biased randomised insertion order.
+    --------------------------------------------------------
+     * NDIM - number of dimensions, 1 <= NDIM <= 3.
+     * HEAD - range of nodes, with MARK() and PVAL(),
+     * TEND   where "dead" nodes have MARK() < 0.
+     * ISET - (output) node indices, in insertion order.
+    --------------------------------------------------------
+     * Nodes are split into rounds via BRIO-RANK, inserted
+     * smallest round first, and ordered along the Hilbert
+     * curve within each round: random enough to keep the
+     * expected cost of Delaunay insertion optimal, local
+     * enough that a walk from the last insertion is short
+     * (Amenta, Choi and Rote, SoCG 2003).
+    --------------------------------------------------------
+     */
+
+    template <
+    typename  real_type ,
+    typename  iter_type ,
+    typename  iptr_list
+             >
+    __normal_call void_type brio_sort (
+        std::size_t _ndim ,
+        iter_type   _head ,
+        iter_type   _tend ,
+        iptr_list  &_iset
+        )
+    {
+        typedef typename
+            iptr_list::data_type        iptr_type ;
+
+        typedef brio_item<iptr_type>    item_type ;
+
+        std::size_t static constexpr
+            KMAX = +3 ;
+
+        real_type _pmin[KMAX] ;
+        real_type _pmax[KMAX] ;
+
+        for (auto _idim = _ndim; _idim-- != 0; )
+        {
+            _pmin[_idim] =
+        +std::numeric_limits<real_type>::infinity() ;
+            _pmax[_idim] =
+        -std::numeric_limits<real_type>::infinity() ;
+        }
+
+    /*----------------------- bounding-box of live nodes */
+        for (auto _iter = _head; _iter != _tend; ++_iter)
+        {
+            if (_iter->mark() < +0) continue ;
+
+            for (auto _idim = _ndim; _idim-- != 0; )
+            {
+                _pmin[_idim] = std::min(
+                    _pmin[_idim], _iter->pval(_idim)) ;
+                _pmax[_idim] = std::max(
+                    _pmax[_idim], _iter->pval(_idim)) ;
+            }
+        }
+
+    /*----------------------- rank + key, then sort once */
+        containers::array<item_type> _sset ;
+
+        iptr_type _ipos = +0 ;
+        for (auto _iter = _head;
+                  _iter!= _tend; ++_iter, ++_ipos)
+        {
+            if (_iter->mark() < +0) continue ;
+
+            item_type _item ;
+            _item._ipos = _ipos ;
+            _item._rank = brio_rank(
+                (std::uint32_t)_ipos) ;
+            _item._hkey = hilbert_key (
+                _ndim, &_iter->pval(0) ,
+                    _pmin, _pmax) ;
+
+            _sset.push_tail(_item) ;
+        }
+
+        algorithms::qsort(
+            _sset.head(), _sset.tend(), brio_less()) ;
+
+        for (auto _iter  = _sset.head() ;
+                  _iter != _sset.tend() ;
+                ++_iter  )
+        {
+            _iset.push_tail(_iter->_ipos) ;
+        }
+    }
+
+    }
+
+#   endif   //__HILBERT__
+
+
+
@@ -0,0 +1,115 @@
+
+    /* 
+    --------------------------------------------------------
+     * RANDOM: re-entrant pseudo-random sequences.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the 
+     * condition that the copyright notices (including this 
+     * entire header) are not removed, and no compensation 
+     * is received through use of the software.  Private, 
+     * research, and institutional use is free.  You may 
+     * distribute modified versions of this code UNDER THE 
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE 
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE 
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE 
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR 
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution 
+     * of this code as part of a commercial system is 
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE 
+     * AUTHOR.  (If you are not directly supplying this 
+     * code to a customer, and you are instead telling them 
+     * how they can obtain it for free, then you are not 
+     * required to make any arrangement with me.) 
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The 
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any 
+     * way whatsoever.  This code is provided "as-is" to be 
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __RANDOM__
+#   define __RANDOM__
+
+#   include <cstdint>
+#   include <limits>
+
+    namespace algorithms {
+
+    /*
+    --------------------------------------------------------
+     * RAND-GEN: a pseudo-random stream with local state.
+    --------------------------------------------------------
+     */
+
+    class rand_gen
+        {
+    /*----------- xorshift64*, used instead of std::rand, 
+                  so that each obj. owns its own sequence */
+        public  :
+        
+        typedef std::uint64_t           word_type ;
+        typedef std::uint32_t           rand_type ;
+        
+        word_type                       _seed ;
+        
+        public  :
+        
+    /*----------------------------- construct from a seed */
+        __inline_call rand_gen (
+            word_type _sval = +1
+            )
+        {   seed(_sval) ;
+        }
+        
+    /*----------------------------- reset to a given seed */
+        __inline_call void_type seed (
+            word_type _sval
+            )
+        {
+        /*------------------- splitmix64: never zero state */
+            _sval += 0x9E3779B97F4A7C15ull ;
+            _sval  = (_sval ^ (_sval >> 30)) 
+                   * 0xBF58476D1CE4E5B9ull ;
+            _sval  = (_sval ^ (_sval >> 27)) 
+                   * 0x94D049BB133111EBull ;
+            _sval  = (_sval ^ (_sval >> 31)) ;
+            
+            this->_seed = 
+               (_sval != +0) ? _sval : +1 ;
+        }
+        
+    /*----------------------------- next int in [0,2^32) */
+        __inline_call rand_type operator() (
+            )
+        {
+            this->_seed ^= this->_seed >> 12 ;
+            this->_seed ^= this->_seed << 25 ;
+            this->_seed ^= this->_seed >> 27 ;
+            
+            return (rand_type) ((this->_seed * 
+                0x2545F4914F6CDD1Dull) >> 32) ;
+        }
+        
+    /*----------------------------- next real in [0,1.0] */
+        __inline_call double real_01 (
+            )
+        {
+            return (double)(*this)() / (double)
+        std::numeric_limits<rand_type>::max() ;
+        }
+        
+        } ;
+
+    }
+
+#   endif   //__RANDOM__
+
+
+
@@ -0,0 +1,399 @@
+
+/*
+------------------------------------------------------------
+ * a flat, open-addressing hash-table.
+------------------------------------------------------------
+ *
+ * HASH-FLAT is a dynamically-sized, open-addressing
+ * hash-table: items live in one linear array of slots,
+ * placed via linear probing with "robin-hood" reorder
+ * and backward-shift deletion, so that probe sequences
+ * stay short and cache-local.
+ *
+ * It offers the FIND/PUSH/_POP interface of HASH-TABLE,
+ * and can be swapped in for it where a container does
+ * not walk the bucket lists directly, nor hold on to
+ * item pointers across updates (slots move as items
+ * are inserted or deleted).
+ *
+ * It backs the TRIA-COMPLEX maps and the DT cavity 
+ * face-set only. The RDEL-COMPLEX lists stay on HASH-
+ * TABLE, since the rDT update walks their buckets and
+ * keeps item pointers across pushes.
+ *
+------------------------------------------------------------
+ */
+
+#   pragma once
+
+#   ifndef __HASH_FLAT__
+#   define __HASH_FLAT__
+
+#   include "array.hpp"
+
+    namespace containers {
+
+#   define __cont containers
+
+    template <
+    typename D ,
+    typename H ,
+    typename P ,
+    typename A = allocators::basic_alloc
+             >
+    class hash_flat
+    {
+/*------------------ a dynamic, open-addressing hash-table */
+    public  :
+
+    typedef D                           data_type ;
+    typedef H                           hash_type ;
+    typedef P                           pred_type ;
+    typedef A                           allocator ;
+
+    typedef std::size_t                 size_type ;
+    typedef std::ptrdiff_t              diff_type ;
+
+    class item_type
+        {
+    /*--------------------- slot: data + cached hash/dist */
+        public  :
+        data_type               _data ;
+        uint32_t                _hash ;
+        uint32_t                _dist ;     // 0 if empty
+        } ;
+
+    typedef containers::array       <
+                    item_type   ,
+                    allocator   >       slot_list ;
+
+    typedef data_type       *           _write_it ;
+    typedef data_type const *           _const_it ;
+
+    typedef containers::hash_flat   <
+                    data_type   ,
+                    hash_type   ,
+                    pred_type   ,
+                    allocator   >       self_type ;
+
+    size_type static const _mini_count = +8 ;
+
+    public  :
+
+    hash_type           _hash;
+    pred_type           _pred;
+
+    double              _load;
+
+    size_type           _size;
+
+    slot_list           _slot;
+
+    public  :
+
+/*------------------------ place item via robin-hood scan */
+    __normal_call data_type* push_item (
+        item_type &&_item
+        )
+    {
+        data_type*_dptr = nullptr ;
+
+        size_type _mask =
+            this->_slot.count() - 1 ;
+        size_type _spos =
+            (size_type)_item._hash & _mask ;
+
+        for ( ; ; _spos = (_spos + 1) & _mask)
+        {
+            item_type&_sptr = this->_slot[_spos] ;
+        /*--------------------------- empty: claim and done */
+            if (_sptr._dist == +0)
+            {
+                _sptr = std::move(_item) ;
+
+                if (_dptr == nullptr)
+                    _dptr = &_sptr._data ;
+
+                break ;
+            }
+        /*--------------------------- "rich" slot: displace */
+            if (_sptr._dist < _item._dist)
+            {
+                std::swap(_sptr, _item) ;
+
+                if (_dptr == nullptr)
+                    _dptr = &_sptr._data ;
+            }
+
+            _item._dist += +1 ;
+        }
+
+        this->_size += +1 ;
+
+        return ( _dptr ) ;
+    }
+
+/*------------------------ find slot index for exact match */
+    __normal_call bool_type find_slot (
+        data_type const&_data,
+        size_type      &_spos
+        )
+    {
+        if (this->_slot.empty()) return false;
+
+        uint32_t  _hval =
+           (uint32_t)this->_hash(_data) ;
+
+        size_type _mask =
+            this->_slot.count() - 1 ;
+
+        _spos = (size_type)_hval & _mask ;
+
+        for (uint32_t _dist = +1; ; ++_dist,
+                _spos = (_spos + 1) & _mask)
+        {
+            item_type&_sptr = this->_slot[_spos] ;
+        /*--------- robin-hood: can't be further than this */
+            if (_sptr._dist < _dist) return false;
+
+            if (_sptr._hash == _hval &&
+                this->_pred(_sptr._data, _data))
+                return true ;
+        }
+    }
+
+/*------------------------ update table count and re-hash */
+    __normal_call void_type redo_hash (
+        size_type _scnt
+        )
+    {
+        size_type _snew = this->_mini_count ;
+        for ( ; _snew < _scnt; _snew *= +2) {}
+
+        if (_snew <= this->_slot.count()) return ;
+
+        slot_list _sold ;
+        std::swap(_sold, this->_slot) ;
+
+        item_type _null ;
+        _null._hash = +0 ;
+        _null._dist = +0 ;
+
+        this->_slot.set_count(_snew,
+            containers::tight_alloc, _null) ;
+
+        this->_size = +0 ;
+
+    /*------------------ re-hash all items onto new table */
+        for (auto _iter  = _sold.head() ;
+                  _iter != _sold.tend() ;
+                ++_iter  )
+        {
+            if (_iter->_dist == +0) continue ;
+
+            _iter->_dist = +1 ;
+
+            push_item(std::move(*_iter)) ;
+        }
+    }
+
+    public  :
+
+/*--------------------------- default c'tor - do nothing! */
+    __normal_call  hash_flat (
+        hash_type const&_hsrc = hash_type(),
+        pred_type const&_psrc = pred_type(),
+        double    const&_lsrc = double(+.8),
+        allocator const&_asrc = allocator()
+    /*----------------------------- c'tor other from obj. */
+        ) : _hash(_hsrc) ,
+            _pred(_psrc) ,
+            _load(_lsrc) ,
+            _size(   +0) ,
+            _slot(_asrc) {}
+
+/*--------------------------- default d'tor/copy/move ops */
+    __inline_call~hash_flat ()  = default ;
+
+    __inline_call hash_flat (
+        self_type const& _src
+            )                    = default ;
+    __inline_call hash_flat (
+        self_type &&     _src
+            )                    = default ;
+
+    __inline_call
+        self_type& operator = (
+        self_type const& _src
+            )                    = default ;
+    __inline_call
+        self_type& operator = (
+        self_type  &&    _src
+            )                    = default ;
+
+/*------------------------------- table size, item count */
+    __inline_call size_type count (
+        ) const
+    {   return  this->_size ;
+    }
+
+    __inline_call bool_type empty (
+        ) const
+    {   return  this->_size == +0 ;
+    }
+
+    __inline_call void_type clear (
+        containers::alloc_types _kind =
+        containers::loose_alloc
+        )
+    {
+        this->_slot.clear(_kind) ;
+        this->_size = +0 ;
+    }
+
+/*------------------------------- pre-size: NSET min slots */
+    __inline_call void_type set_slots (
+        size_type _nset
+        )
+    {   redo_hash(_nset) ;
+    }
+
+/*------------------------------- calc. table load-factor */
+    __inline_call double    load_fact (
+        size_type _iinc = +0
+        )
+    {   return this->_slot.empty() ? 1. :
+                 (double)(this->_size +_iinc) /
+                 (double) this->_slot.count() ;
+    }
+
+/*----------------------------- push data onto hash table */
+    __normal_call _write_it push ( // copy construct
+        data_type const&_data
+        )
+    {
+        item_type _item ;
+        _item._data = _data ;
+
+        return push(std::move(_item._data)) ;
+    }
+
+/*----------------------------- push data onto hash table */
+    __normal_call _write_it push ( // move construct
+        data_type &&    _data
+        )
+    {
+    /*------------- re-size table if load factor exceeded */
+        if (load_fact(1)> this->_load)
+            redo_hash(this->_slot.count() * 2) ;
+    /*------------------------------- evaluate hash value */
+        item_type _item ;
+        _item._hash = (uint32_t)this->_hash(_data) ;
+        _item._dist = +1 ;
+        _item._data = std::move(_data) ;
+    /*------------------------------- push data onto slot */
+        return push_item(std::move(_item)) ;
+    }
+
+/*-------------------------- scan table for exact matches */
+    __normal_call bool_type find (
+        data_type const&_data,
+        _write_it      &_same
+        )
+    {
+        size_type _spos ;
+        if (find_slot(_data, _spos))
+        {
+            _same = &this->_slot[_spos]._data ;
+
+            return true ;
+        }
+
+        return false ;
+    }
+
+/*--------------------- _pop any exact matches from table */
+    __normal_call bool_type _pop (
+        data_type const&_data,
+        data_type      &_same
+        )
+    {
+        size_type _spos ;
+        if (!find_slot(_data, _spos)) return false ;
+
+    /*------------------------ steal data before the _pop */
+        _same = std::move(this->_slot[_spos]._data) ;
+
+    /*------------------------ backward-shift the run down */
+        size_type _mask =
+            this->_slot.count() - 1 ;
+
+        for ( ; ; )
+        {
+            size_type _next = (_spos + 1) & _mask ;
+
+            item_type&_sptr = this->_slot[_spos] ;
+            item_type&_nptr = this->_slot[_next] ;
+
+            if (_nptr._dist <= +1)
+            {
+                _sptr._dist = +0 ; break ;
+            }
+
+            _sptr = std::move(_nptr) ;
+            _sptr._dist -= +1 ;
+
+            _spos = _next ;
+        }
+
+        this->_size -= +1 ;
+
+        return true ;
+    }
+
+/*---------------------- scan table and report statistics */
+    __normal_call void_type _get_info (
+        size_type &_min_count,
+        size_type &_max_count,
+        double    &_ave_count
+        )
+    {
+    /*----------------- as per HASH-TABLE, but probe dist */
+        _min_count =
+         std::numeric_limits<size_type>::max();
+        _max_count =
+         std::numeric_limits<size_type>::min();
+
+        _ave_count = (double)+.0;
+
+        for (auto _iter  = this->_slot.head() ;
+                  _iter != this->_slot.tend() ;
+                ++_iter  )
+        {
+            if (_iter->_dist == +0) continue ;
+
+            size_type _dist = _iter->_dist ;
+
+            if (_min_count > _dist)
+                _min_count = _dist;
+            if (_max_count < _dist)
+                _max_count = _dist;
+
+            _ave_count += (double)_dist;
+        }
+
+        if (this->_size > +0)
+        _ave_count /= this->_size ;
+    }
+
+    } ;
+
+#   undef  __cont
+
+
+    }
+
+#   endif   //__HASH_FLAT__
+
+
+
@@ -216,6 +216,14 @@
                  (double) this->_lptr.count() ;
     }
 
+/*------------------------------- set bucket count (empty!) */
+    __inline_call void_type set_slots (
+        size_type _nset
+        )
+    {   this->_lptr.set_count(_nset ,
+            containers::loose_alloc, nullptr) ;
+    }
+
 /*----------------------------- push data onto hash table */
     __normal_call _write_it push ( // copy construct
         data_type const&_data
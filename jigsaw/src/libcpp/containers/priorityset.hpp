@@ -415,6 +415,49 @@
         } 
         this->_heap._pop_tail() ;
     }
+
+    /*
+    --------------------------------------------------------
+     * _POP-TEST: _pop all items for which TEST is TRUE
+    --------------------------------------------------------
+     * Kept items are sifted-up into a new heap, front-
+     * to-back: O(N*log(N)) in the worst case.
+    --------------------------------------------------------
+     */
+
+    template <
+    typename      test_type
+             >
+    __normal_call size_type _pop_test (
+        test_type const&_test
+        )
+    {
+        size_type _inum = +0 ;
+        size_type _knum = +0 ;
+        size_type _iend = 
+        this->_heap.count () ;
+        for ( ; _inum < _iend; ++_inum)
+        {
+            if (_test(this->_heap[_inum])) continue ;
+    
+    /*---------- sift-up kept items in-place, front-to-back */
+            data_type _data = std::move (
+                this->_heap[_inum]) ;
+
+            _write_it _ipos = push_upper (
+                this->_heap.head() ,
+                this->_heap.head() + _knum , 
+                _data) ;
+
+           *_ipos = std::move(_data) ;
+
+            _knum += +1 ;
+        }
+
+        this->_heap.set_count(_knum) ;
+
+        return ( _iend - _knum ) ;
+    }
     
     /*
     --------------------------------------------------------
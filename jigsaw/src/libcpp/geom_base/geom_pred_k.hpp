@@ -122,6 +122,10 @@
 #include <stdlib.h>
 #include <math.h>
 
+#ifdef __use_pred_stats
+#include <atomic>
+#endif
+
 namespace geompred
 {
 
@@ -376,6 +380,68 @@ REAL o3derrboundA, o3derrboundB, o3derrboundC;
 REAL iccerrboundA, iccerrboundB, iccerrboundC;
 REAL isperrboundA, isperrboundB, isperrboundC;
 
+/*****************************************************************************/
+/*                                                                           */
+/*  Predicate statistics, opt-in via __use_pred_stats.                       */
+/*                                                                           */
+/*  Each predicate counts the stage at which its sign is decided: A is the   */
+/*  floating-point filter, B and C the adaptive corrections, and D the exact */
+/*  expansion arithmetic.  Row PREDDDFLT counts the double-double (dd_flt)   */
+/*  interpolations in intersect_k.hpp -- stage A where a plain double result */
+/*  is returned instead, stage D where dd_flt is used.  The counters are     */
+/*  global and atomic, so that threads can share them: take a snapshot via   */
+/*  predstatsnap() at the start and end of a run, and report the difference. */
+/*  Without __use_pred_stats, Predstat() compiles to nothing, and snapshots  */
+/*  are all zero.                                                            */
+/*                                                                           */
+/*****************************************************************************/
+
+#define PREDORIENT2D 0
+#define PREDORIENT3D 1
+#define PREDINCIRCLE 2
+#define PREDINSPHERE 3
+#define PREDDDFLT    4
+#define PREDKINDS    5
+
+#define PREDSTAGEA   0
+#define PREDSTAGEB   1
+#define PREDSTAGEC   2
+#define PREDSTAGED   3
+#define PREDSTAGES   4
+
+typedef struct {
+  unsigned long long count[PREDKINDS][PREDSTAGES];
+} predstatlist;
+
+#ifdef __use_pred_stats
+
+std::atomic<unsigned long long> predstats[PREDKINDS][PREDSTAGES];
+
+#define Predstat(kind, stage) \
+  geompred::predstats[kind][stage].fetch_add(1, std::memory_order_relaxed)
+
+#else
+
+#define Predstat(kind, stage)                            /* nothing */
+
+#endif
+
+void predstatsnap (
+  predstatlist *list)
+{
+  int i, j;
+
+  for (i = 0; i < PREDKINDS; i++) {
+    for (j = 0; j < PREDSTAGES; j++) {
+#ifdef __use_pred_stats
+      list->count[i][j] = predstats[i][j].load(std::memory_order_relaxed);
+#else
+      list->count[i][j] = 0;
+#endif
+    }
+  }
+}
+
 /*****************************************************************************/
 /*                                                                           */
 /*  exactinit()   Initialize the variables used for exact arithmetic.        */
@@ -395,7 +461,7 @@ REAL isperrboundA, isperrboundB, isperrboundC;
 /*                                                                           */
 /*****************************************************************************/
 
-void exactinit()
+void exactcalc()
 {
   REAL half;
   REAL check, lastcheck;
@@ -437,6 +503,19 @@ void exactinit()
   isperrboundC = (71.0 + 1408.0 * epsilon) * epsilon * epsilon;
 }
 
+/*  exactinit() is called by every new triangulation, and so may be called   */
+/*    concurrently when several meshes are built in one process.  The values */
+/*    above depend only on the floating-point format, so they are computed   */
+/*    just once: C++11 guarantees that a function-local static is            */
+/*    initialised exactly once, and is thread-safe.  After that, the globals */
+/*    are only ever read.                                                    */
+
+void exactinit()
+{
+  static int const _done = (exactcalc(), 1);
+  (void) _done;
+}
+
 /*****************************************************************************/
 /*                                                                           */
 /*  grow_expansion()   Add a scalar to an expansion.                         */
@@ -1330,6 +1409,7 @@ REAL orient2dadapt (
   det = estimate(4, B);
   errbound = ccwerrboundB * detsum;
   if ((det >= errbound) || (-det >= errbound)) {
+    Predstat(PREDORIENT2D, PREDSTAGEB);
     return det;
   }
 
@@ -1340,6 +1420,7 @@ REAL orient2dadapt (
 
   if ((acxtail == 0.0) && (acytail == 0.0)
       && (bcxtail == 0.0) && (bcytail == 0.0)) {
+    Predstat(PREDORIENT2D, PREDSTAGEB);
     return det;
   }
 
@@ -1347,6 +1428,7 @@ REAL orient2dadapt (
   det += (acx * bcytail + bcy * acxtail)
        - (acy * bcxtail + bcx * acytail);
   if ((det >= errbound) || (-det >= errbound)) {
+    Predstat(PREDORIENT2D, PREDSTAGEC);
     return det;
   }
 
@@ -1368,6 +1450,7 @@ REAL orient2dadapt (
   u[3] = u3;
   Dlength = fast_expansion_sum_zeroelim(C2length, C2, 4, u, D);
 
+  Predstat(PREDORIENT2D, PREDSTAGED);
   return(D[Dlength - 1]);
 }
 
@@ -1385,22 +1468,26 @@ REAL orient2d (
 
   if (detleft > 0.0) {
     if (detright <= 0.0) {
+      Predstat(PREDORIENT2D, PREDSTAGEA);
       return det;
     } else {
       detsum = detleft + detright;
     }
   } else if (detleft < 0.0) {
     if (detright >= 0.0) {
+      Predstat(PREDORIENT2D, PREDSTAGEA);
       return det;
     } else {
       detsum = -detleft - detright;
     }
   } else {
+    Predstat(PREDORIENT2D, PREDSTAGEA);
     return det;
   }
 
   errbound = ccwerrboundA * detsum;
   if ((det >= errbound) || (-det >= errbound)) {
+    Predstat(PREDORIENT2D, PREDSTAGEA);
     return det;
   }
 
@@ -1730,6 +1817,7 @@ REAL orient3dadapt (
   det = estimate(finlength, fin1);
   errbound = o3derrboundB * permanent;
   if ((det >= errbound) || (-det >= errbound)) {
+    Predstat(PREDORIENT3D, PREDSTAGEB);
     return det;
   }
 
@@ -1746,6 +1834,7 @@ REAL orient3dadapt (
   if ((adxtail == 0.0) && (bdxtail == 0.0) && (cdxtail == 0.0)
       && (adytail == 0.0) && (bdytail == 0.0) && (cdytail == 0.0)
       && (adztail == 0.0) && (bdztail == 0.0) && (cdztail == 0.0)) {
+    Predstat(PREDORIENT3D, PREDSTAGEB);
     return det;
   }
 
@@ -1760,6 +1849,7 @@ REAL orient3dadapt (
                  - (ady * bdxtail + bdx * adytail))
           + cdztail * (adx * bdy - ady * bdx));
   if ((det >= errbound) || (-det >= errbound)) {
+    Predstat(PREDORIENT3D, PREDSTAGEC);
     return det;
   }
 
@@ -2040,6 +2130,7 @@ REAL orient3dadapt (
     finswap = finnow; finnow = finother; finother = finswap;
   }
 
+  Predstat(PREDORIENT3D, PREDSTAGED);
   return finnow[finlength - 1];
 }
 
@@ -2082,6 +2173,7 @@ REAL orient3d (
             + (Absolute(adxbdy) + Absolute(bdxady)) * Absolute(cdz);
   errbound = o3derrboundA * permanent;
   if ((det > errbound) || (-det > errbound)) {
+    Predstat(PREDORIENT3D, PREDSTAGEA);
     return det;
   }
 
@@ -2514,6 +2606,7 @@ REAL incircleadapt (
   det = estimate(finlength, fin1);
   errbound = iccerrboundB * permanent;
   if ((det >= errbound) || (-det >= errbound)) {
+    Predstat(PREDINCIRCLE, PREDSTAGEB);
     return det;
   }
 
@@ -2525,6 +2618,7 @@ REAL incircleadapt (
   Two_Diff_Tail(pc[1], pd[1], cdy, cdytail);
   if ((adxtail == 0.0) && (bdxtail == 0.0) && (cdxtail == 0.0)
       && (adytail == 0.0) && (bdytail == 0.0) && (cdytail == 0.0)) {
+    Predstat(PREDINCIRCLE, PREDSTAGEB);
     return det;
   }
 
@@ -2539,6 +2633,7 @@ REAL incircleadapt (
                                      - (ady * bdxtail + bdx * adytail))
           + 2.0 * (cdx * cdxtail + cdy * cdytail) * (adx * bdy - ady * bdx));
   if ((det >= errbound) || (-det >= errbound)) {
+    Predstat(PREDINCIRCLE, PREDSTAGEC);
     return det;
   }
 
@@ -2974,6 +3069,7 @@ REAL incircleadapt (
     }
   }
 
+  Predstat(PREDINCIRCLE, PREDSTAGED);
   return finnow[finlength - 1];
 }
 
@@ -3017,6 +3113,7 @@ REAL incircle (
             + (Absolute(adxbdy) + Absolute(bdxady)) * clift;
   errbound = iccerrboundA * permanent;
   if ((det > errbound) || (-det > errbound)) {
+    Predstat(PREDINCIRCLE, PREDSTAGEA);
     return det;
   }
 
@@ -3847,6 +3944,7 @@ REAL insphereadapt (
   det = estimate(finlength, fin1);
   errbound = isperrboundB * permanent;
   if ((det >= errbound) || (-det >= errbound)) {
+    Predstat(PREDINSPHERE, PREDSTAGEB);
     return det;
   }
 
@@ -3866,6 +3964,7 @@ REAL insphereadapt (
       && (bextail == 0.0) && (beytail == 0.0) && (beztail == 0.0)
       && (cextail == 0.0) && (ceytail == 0.0) && (ceztail == 0.0)
       && (dextail == 0.0) && (deytail == 0.0) && (deztail == 0.0)) {
+    Predstat(PREDINSPHERE, PREDSTAGEB);
     return det;
   }
 
@@ -3903,9 +4002,11 @@ REAL insphereadapt (
                  + (cex * cextail + cey * ceytail + cez * ceztail)
                  * (dez * ab3 + aez * bd3 + bez * da3)));
   if ((det >= errbound) || (-det >= errbound)) {
+    Predstat(PREDINSPHERE, PREDSTAGEC);
     return det;
   }
 
+  Predstat(PREDINSPHERE, PREDSTAGED);
   return insphereexact(pa, pb, pc, pd, pe);
 }
 
@@ -4010,12 +4111,118 @@ REAL insphere (
             * dlift;
   errbound = isperrboundA * permanent;
   if ((det > errbound) || (-det > errbound)) {
+    Predstat(PREDINSPHERE, PREDSTAGEA);
     return det;
   }
 
   return insphereadapt(pa, pb, pc, pd, pe, permanent);
 }
 
+/*****************************************************************************/
+/*                                                                           */
+/*  inspherefilt()   Semi-static filtered insphere test.  Robust.            */
+/*                                                                           */
+/*               A front-end to insphere() above, returning a value with     */
+/*               the same sign.  The determinant is evaluated as per stage   */
+/*               A, but its error bound is taken from the largest coordinate */
+/*               differences along each axis -- scaled by a compile-time     */
+/*               constant -- rather than by summing the permanent, since     */
+/*                                                                           */
+/*    permanent <= 24 * mx * my * mz * (mx^2 + my^2 + mz^2) .                */
+/*                                                                           */
+/*  The constant is isperrboundA * 24, with a little slack for roundoff in   */
+/*  the bound itself, and assumes IEEE 754 double precision.  The analysis   */
+/*  also assumes no underflow or overflow, so inputs with differences out of */
+/*  a safe range, as well as any determinant that does not clear the bound,  */
+/*  are passed to insphere() unchanged.                                      */
+/*                                                                           */
+/*  For the orient2d(), orient3d() and incircle() tests, stage A is already  */
+/*  about as cheap as such a filter, and they are used as-is.                */
+/*                                                                           */
+/*****************************************************************************/
+
+REAL constexpr filtepsilon = 1.1102230246251565e-16;          /* = 2^(-53) */
+REAL constexpr filtslack = 1.0 + 1.0e-12;
+
+REAL constexpr ispfiltbound = 
+  24.0 * (16.0 + 224.0 * filtepsilon) * filtepsilon * filtslack;
+
+/*  Safe range for the coordinate differences: the bound is a product of     */
+/*  five of them, and must neither underflow nor overflow.                   */
+
+REAL constexpr ispfiltlower = 1.0e-58 , ispfiltupper = 1.0e+61 ;
+
+#define Filtmax(a, b)  ((a) >= (b) ? (a) : (b))
+#define Filtmin(a, b)  ((a) <= (b) ? (a) : (b))
+
+REAL inspherefilt (
+  REAL *pa, 
+  REAL *pb, 
+  REAL *pc, 
+  REAL *pd, 
+  REAL *pe)
+{
+  REAL aex, bex, cex, dex, aey, bey, cey, dey, aez, bez, cez, dez;
+  REAL ab, bc, cd, da, ac, bd;
+  REAL alift, blift, clift, dlift;
+  REAL maxx, maxy, maxz, minv, maxv;
+  REAL det, errbound;
+
+  aex = pa[0] - pe[0];
+  bex = pb[0] - pe[0];
+  cex = pc[0] - pe[0];
+  dex = pd[0] - pe[0];
+  aey = pa[1] - pe[1];
+  bey = pb[1] - pe[1];
+  cey = pc[1] - pe[1];
+  dey = pd[1] - pe[1];
+  aez = pa[2] - pe[2];
+  bez = pb[2] - pe[2];
+  cez = pc[2] - pe[2];
+  dez = pd[2] - pe[2];
+
+  ab = aex * bey - bex * aey;
+  bc = bex * cey - cex * bey;
+  cd = cex * dey - dex * cey;
+  da = dex * aey - aex * dey;
+  ac = aex * cey - cex * aey;
+  bd = bex * dey - dex * bey;
+
+  alift = aex * aex + aey * aey + aez * aez;
+  blift = bex * bex + bey * bey + bez * bez;
+  clift = cex * cex + cey * cey + cez * cez;
+  dlift = dex * dex + dey * dey + dez * dez;
+
+  det = (dlift * (aez * bc - bez * ac + cez * ab)
+       - clift * (dez * ab + aez * bd + bez * da))
+      + (blift * (cez * da + dez * ac + aez * cd)
+       - alift * (bez * cd - cez * bd + dez * bc));
+
+  maxx = Filtmax(Absolute(aex), Absolute(bex));
+  maxx = Filtmax(Filtmax(Absolute(cex), Absolute(dex)), maxx);
+  maxy = Filtmax(Absolute(aey), Absolute(bey));
+  maxy = Filtmax(Filtmax(Absolute(cey), Absolute(dey)), maxy);
+  maxz = Filtmax(Absolute(aez), Absolute(bez));
+  maxz = Filtmax(Filtmax(Absolute(cez), Absolute(dez)), maxz);
+
+  minv = Filtmin(Filtmin(maxx, maxy), maxz);
+  maxv = Filtmax(Filtmax(maxx, maxy), maxz);
+
+  if (minv >= ispfiltlower && maxv <= ispfiltupper) {
+    errbound = ispfiltbound * maxx * maxy * maxz 
+             * (maxx * maxx + maxy * maxy + maxz * maxz);
+    if ((det > errbound) || (-det > errbound)) {
+      Predstat(PREDINSPHERE, PREDSTAGEA);
+      return det;
+    }
+  }
+
+  return insphere(pa, pb, pc, pd, pe);
+}
+
+#undef Filtmax
+#undef Filtmin
+
 }
 
 #endif//__GEOMPRED__
@@ -165,6 +165,8 @@
                            ? _qa 
                            : _qb ;
             
+            Predstat(PREDDDFLT, PREDSTAGED) ;
+
             dd_flt _WB = _tt[0] ;
             _WB = (dd_flt)+1. + _WB;
             _WB = (dd_flt)+.5 * _WB;
@@ -198,6 +200,8 @@
                            ? _qa 
                            : _qb ;
                            
+            Predstat(PREDDDFLT, PREDSTAGED) ;
+
             dd_flt _WB = _tt[1] ;
             _WB = (dd_flt)+1. + _WB;
             _WB = (dd_flt)+.5 * _WB;
@@ -274,6 +278,8 @@
                            ? _qa 
                            : _qb ;
              
+            Predstat(PREDDDFLT, PREDSTAGED) ;
+
             dd_flt _WB = _tt[0] ;
             _WB = (dd_flt)+1. + _WB;
             _WB = (dd_flt)+.5 * _WB;
@@ -312,6 +318,8 @@
                            ? _qa 
                            : _qb ;
            
+            Predstat(PREDDDFLT, PREDSTAGED) ;
+
             dd_flt _WB = _tt[1] ;
             _WB = (dd_flt)+1. + _WB;
             _WB = (dd_flt)+.5 * _WB;
@@ -427,6 +435,8 @@
 
         if (_tt == (data_type)+0.)
         {
+        Predstat(PREDDDFLT, PREDSTAGEA) ;
+
         _qq[0] = _pa[0] ;
         _qq[1] = _pa[1] ;
         _qq[2] = _pa[2] ;
@@ -434,12 +444,16 @@
         else
         if (_tt == (data_type)+1.)
         {
+        Predstat(PREDDDFLT, PREDSTAGEA) ;
+
         _qq[0] = _pb[0] ;
         _qq[1] = _pb[1] ;
         _qq[2] = _pb[2] ;
         }
         else
         {
+        Predstat(PREDDDFLT, PREDSTAGED) ;
+
         dd_flt _AB[3];
         _AB[0] = _pb[0] ;
         _AB[1] = _pb[1] ;
@@ -1134,6 +1148,8 @@
             if (_part == +1)
             {
     /*----------------------- calc. intersection on [a,b] */
+                Predstat(PREDDDFLT, PREDSTAGED) ;
+
                 dd_flt _WA = 1. - _tu ;
                 dd_flt _WB = 0. + _tu ;
 
@@ -1158,6 +1174,8 @@
             if (_part == +2)
             {
     /*----------------------- calc. intersection on [c,d] */
+                Predstat(PREDDDFLT, PREDSTAGED) ;
+
                 dd_flt _WC = 1. - _tv ;
                 dd_flt _WD = 0. + _tv ;
 
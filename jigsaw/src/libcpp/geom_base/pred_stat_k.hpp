@@ -0,0 +1,116 @@
+
+    /*
+    --------------------------------------------------------
+     * PRED-STAT-K: per-run counts of predicate stages.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the 
+     * condition that the copyright notices (including this 
+     * entire header) are not removed, and no compensation 
+     * is received through use of the software.  Private, 
+     * research, and institutional use is free.  You may 
+     * distribute modified versions of this code UNDER THE 
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE 
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE 
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE 
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR 
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution 
+     * of this code as part of a commercial system is 
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE 
+     * AUTHOR.  (If you are not directly supplying this 
+     * code to a customer, and you are instead telling them 
+     * how they can obtain it for free, then you are not 
+     * required to make any arrangement with me.) 
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The 
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any 
+     * way whatsoever.  This code is provided "as-is" to be 
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * PRED-STATS snapshots the global counters of GEOM-
+     * PRED-K at PRED-INIT, and PRED-DUMP reports counts
+     * since then. A base for the RDEL/ITER timer types;
+     * the dump is empty unless __use_pred_stats is set.
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __PRED_STAT_K__
+#   define __PRED_STAT_K__
+
+    namespace geompred {
+
+    class pred_stats
+        {
+        public  :
+
+        geompred::predstatlist _pred_init ;
+        
+        __inline_call void_type pred_init (
+            )
+        {
+            geompred::predstatsnap(&this->_pred_init) ;
+        }
+        
+        template <
+        typename      text_dump
+                 >
+        __normal_call void_type pred_dump (
+            text_dump &_dump
+            )
+        {
+    /*------------- counts since PRED-INIT, stages A to D */
+        #   ifdef  __use_pred_stats
+        
+            geompred::predstatlist _pred_done ;
+            geompred::predstatsnap(&_pred_done) ;
+            
+            char const *_name[PREDKINDS] = {
+                "  ORIENT-2D = " ,
+                "  ORIENT-3D = " ,
+                "  INCIRCLE  = " ,
+                "  INSPHERE  = " ,
+                "  DD-INTERP = " } ;
+                
+            _dump.push("\n")  ;
+            _dump.push("  PREDICATE stages (A/B/C/D)... \n") ;
+            _dump.push("\n")  ;
+            
+            for (auto _kind = +0; 
+                      _kind < PREDKINDS; ++_kind)
+            {
+                _dump.push(_name[_kind]) ;
+                
+            for (auto _pass = +0; 
+                      _pass < PREDSTAGES; ++_pass)
+            {
+                if (_pass > +0) _dump.push(" / ") ;
+                
+                _dump.push(std::to_string(
+                    _pred_done.count[_kind][_pass] -
+              this->_pred_init.count[_kind][_pass])) ;
+            }
+                _dump.push("\n")  ;
+            }
+            
+        #   else
+        
+            __unreferenced(_dump) ;
+            
+        #   endif//__use_pred_stats
+        }
+
+        } ;
+
+    }
+
+#   endif   //__PRED_STAT_K__
+
+
+
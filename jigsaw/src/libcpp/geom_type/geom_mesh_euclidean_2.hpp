@@ -272,6 +272,9 @@
                 bbox_bnds ,
                 allocator       >   bbox_list ;
     
+    typedef containers::fixed_array <
+                iptr_type , 2   >   grid_dims ;
+    
     typedef mesh::tria_complex_1<
                 node_type ,
                 edge_type ,
@@ -293,6 +296,9 @@
 
     iptr_type static constexpr _nbox = 4 ;
     
+    iptr_type static constexpr _gbnd =-2 ;
+    iptr_type static constexpr _gnul =-3 ;
+    
     public  :
     
     pool_base                      _pool ;
@@ -310,6 +316,13 @@
 
     tree_type                      _ebox ;
     
+    algorithms::rand_gen           _rand ;
+    
+    grid_dims                      _gnum ;
+    bbox_bnds                      _gmin ;
+    bbox_bnds                      _glen ;
+    iptr_list                      _gtag ;
+    
     public  :
     
     /*
@@ -329,7 +342,9 @@
             _pmin(    _asrc ) ,
             _pmax(    _asrc ) ,
             _tria(    _asrc ) ,
-            _ebox(    _asrc )
+            _ebox(    _asrc ) ,
+            _rand(       +1 ) ,
+            _gtag(    _asrc )
         {
         }
      
@@ -826,6 +841,11 @@
                   this->_ebox,
        _BTOL,this->_nbox, edge_pred () 
                  ) ;
+                 
+        this->_ebox.freeze() ;  // cache-linear queries
+        
+    /*-------------------- bg. grid of IS-INSIDE states */
+        init_grid (_BTOL);
     }
 
     /*
@@ -1340,6 +1360,286 @@
         return (   _func._find ) ;
     }
     
+    /*
+    --------------------------------------------------------
+     * INIT-GRID: cache IS-INSIDE state on a bg. grid.
+    --------------------------------------------------------
+     */
+     
+    class grid_pred
+        {
+    /*------------------ TRUE if any edge overlaps a cell */
+        public  :
+        real_type      _rmin[2] ;
+        real_type      _rmax[2] ;
+        
+        geom_type     &_geom ;
+        
+        bool_type      _find ;
+        
+        public  :
+        
+        grid_pred operator = (
+            grid_pred & 
+            )                   =     delete ;
+        grid_pred operator = (
+            grid_pred&& 
+            )                   =     delete ;
+        
+        public  :
+    /*------------------------- construct from _src. obj. */
+        __normal_call grid_pred (
+            real_type *_lsrc ,
+            real_type *_rsrc ,
+            geom_type &_gsrc
+            ) : _geom( _gsrc)
+        {
+            this->_rmin[0] = _lsrc[0];
+            this->_rmin[1] = _lsrc[1];
+            
+            this->_rmax[0] = _rsrc[0];
+            this->_rmax[1] = _rsrc[1];
+            
+            this->_find    = false ;
+        }
+    /*----------------------- edge-rect overlap, via SAT. */
+        __normal_call  void_type operator()  (
+            typename  
+            tree_type::item_data *_iptr
+            )
+        {
+            for ( ; _iptr != nullptr && 
+                       !this->_find ; 
+                        _iptr = _iptr->_next )
+            {
+                iptr_type  _epos = 
+                    _iptr->_data.ipos() ;
+                
+                real_type *_ipos = &_geom._tria.
+                    _set1[_geom._tria.
+                    _set2[_epos].node(0)].pval(0);
+                real_type *_jpos = &_geom._tria.
+                    _set1[_geom._tria.
+                    _set2[_epos].node(1)].pval(0);
+                
+            /*--------------- test edge aabb against rect */
+                if (std::max(_ipos[0], _jpos[0]) 
+                        < this->_rmin[0] ||
+                    std::max(_ipos[1], _jpos[1]) 
+                        < this->_rmin[1] ||
+                    std::min(_ipos[0], _jpos[0]) 
+                        > this->_rmax[0] ||
+                    std::min(_ipos[1], _jpos[1]) 
+                        > this->_rmax[1] )
+                    continue ;
+                
+            /*--------------- test edge normal about rect */
+                real_type _nvec[2] = {
+                    _jpos[1] - _ipos[1] ,
+                    _ipos[0] - _jpos[0] } ;
+                
+                iptr_type _sneg = +0 ;
+                iptr_type _spos = +0 ;
+                for (auto _ivrt = 4; _ivrt-- != 0; )
+                {
+                real_type _xpos = (_ivrt & 1) ?
+                    _rmax[0] : _rmin[0] ;
+                real_type _ypos = (_ivrt & 2) ?
+                    _rmax[1] : _rmin[1] ;
+                
+                real_type _dval = 
+                _nvec[0] * (_xpos - _ipos[0]) +
+                _nvec[1] * (_ypos - _ipos[1]) ;
+                
+                if (_dval <= (real_type)0.)
+                    _sneg += +1 ;
+                if (_dval >= (real_type)0.)
+                    _spos += +1 ;
+                }
+                
+                if (_sneg > 0 && _spos > 0) 
+                    this->_find = true ;
+            }
+        }
+        
+        } ;
+    
+    __normal_call void_type init_grid (
+        real_type *_BTOL
+        )
+    {
+        iptr_type static constexpr _GMAX = 1024 ;
+        
+    /*------------------ tree-rect intersection predicate */
+        typedef 
+        geom_tree::aabb_pred_rect_k <
+             real_type, 
+             iptr_type, 
+             +2        >  tree_pred ; 
+        
+        iptr_list _cell, _work ;
+        
+        this->_gtag.clear() ;
+        
+        real_type _blen[2] = {
+            this->_bmax[0] - this->_bmin[0] ,
+            this->_bmax[1] - this->_bmin[1] 
+            } ;
+        
+        if (!(_blen[0] > (real_type)0.) ||
+            !(_blen[1] > (real_type)0.) )
+            return ;        // degenerate or empty
+        
+    /*------------------ approx. 4 cells per indexed edge */
+        real_type _ncel = (real_type)4. * 
+        std::max((real_type)1., (real_type)
+            this->_tria._set2.count()) ;
+        
+        real_type _hlen = std::sqrt (
+            _blen[0] * _blen[1] / _ncel ) ;
+        
+        for (auto _idim = 2; _idim-- != 0; )
+        {
+            iptr_type _nnum = (iptr_type)
+                std::ceil(_blen[_idim]/_hlen) ;
+            
+            _nnum = std::max(_nnum, +1) ;
+            _nnum = std::min(_nnum, _GMAX) ;
+        
+            this->_gnum[_idim] = _nnum ;
+            this->_gmin[_idim] = 
+                this->_bmin[_idim] ;
+            this->_glen[_idim] = 
+                _blen[_idim] / _nnum ;
+        }
+        
+        iptr_type _xnum = this->_gnum[0] ;
+        iptr_type _ynum = this->_gnum[1] ;
+        
+    /*------------------ mark cells cut by any geom. edge */
+        _cell.set_count(_xnum * _ynum, 
+            containers::tight_alloc, 
+           (iptr_type)_gnul) ;
+        
+        for (auto _jpos = 0; _jpos < _ynum; ++_jpos)
+        for (auto _ipos = 0; _ipos < _xnum; ++_ipos)
+        {
+            real_type _rmin[2] = {
+            _gmin[0] + _ipos * _glen[0] 
+                - _BTOL[0] ,
+            _gmin[1] + _jpos * _glen[1] 
+                - _BTOL[1]
+                } ;
+            real_type _rmax[2] = {
+            _gmin[0] + (_ipos+1) * _glen[0] 
+                + _BTOL[0] ,
+            _gmin[1] + (_jpos+1) * _glen[1] 
+                + _BTOL[1]
+                } ;
+        
+            tree_pred _pred(_rmin, _rmax) ;
+            grid_pred _func(_rmin, _rmax, 
+                            *this ) ;
+        
+            this->_ebox.find(_pred,_func) ;
+            
+            if (_func._find)
+            _cell[_jpos*_xnum+_ipos] = _gbnd ;
+        }
+        
+    /*------------------ flood-fill edge-free components: *
+     * state is const. away from edges, so one ray-cast  *
+     * test per component fixes every cell within it.   */
+        for (auto _iter = _cell.count(); 
+                  _iter-- != 0 ; )
+        {
+            if (_cell[_iter] != _gnul) continue ;
+            
+            iptr_type _ipos = 
+           (iptr_type)_iter % _xnum ;
+            iptr_type _jpos = 
+           (iptr_type)_iter / _xnum ;
+            
+            real_type _pmid[2] = {
+            _gmin[0] + (_ipos+.5) * _glen[0] ,
+            _gmin[1] + (_jpos+.5) * _glen[1]
+                } ;
+            
+            iptr_type _itag = 
+                this->is_inside(_pmid) ;
+            
+            _cell[_iter] = _itag ;
+            _work.push_tail((iptr_type)_iter) ;
+            
+            while (!_work.empty())
+            {
+                iptr_type _cpos = 
+                   *_work.tail() ;
+                _work._pop_tail() ;
+                
+                _ipos = _cpos % _xnum ;
+                _jpos = _cpos / _xnum ;
+                
+                iptr_type _next[4] = {
+                    _ipos > +0 ? _cpos-1 : -1 ,
+                    _ipos < _xnum-1 ?
+                        _cpos+1 : -1 ,
+                    _jpos > +0 ? 
+                        _cpos-_xnum : -1 ,
+                    _jpos < _ynum-1 ?
+                        _cpos+_xnum : -1 
+                    } ;
+                
+                for (auto _inxt = 4; _inxt-- != 0; )
+                {
+                    iptr_type _npos = _next[_inxt] ;
+                    if (_npos < +0) continue ;
+                    
+                    if (_cell[_npos] == _gnul)
+                    {
+                        _cell[_npos] = _itag ;
+                        _work.push_tail(_npos) ;
+                    }
+                }
+            }
+        }
+        
+        this->_gtag = std::move(_cell) ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * FIND-GRID: cached IS-INSIDE state, or _GBND if the
+     * cell is cut by the geom., or lies outside the grid.
+    --------------------------------------------------------
+     */
+    
+    __inline_call iptr_type find_grid (
+        real_type *_ppos
+        )
+    {
+        if (this->_gtag.empty()) return _gbnd ;
+        
+        real_type _xval = (_ppos[0] - 
+            this->_gmin[0]) / this->_glen[0] ;
+        real_type _yval = (_ppos[1] - 
+            this->_gmin[1]) / this->_glen[1] ;
+        
+        if (!(_xval >= (real_type)0.) ||
+            !(_yval >= (real_type)0.) )
+            return _gbnd ;
+        
+        if (!(_xval < (real_type)_gnum[0]) ||
+            !(_yval < (real_type)_gnum[1]) )
+            return _gbnd ;
+        
+        iptr_type _ipos = (iptr_type)_xval ;
+        iptr_type _jpos = (iptr_type)_yval ;
+        
+        return this->_gtag[
+            _jpos * _gnum[0] + _ipos] ;
+    }
+    
     /*
     --------------------------------------------------------
      * IS-INSIDE: TRUE if point is "inside" geometry.
@@ -1370,6 +1670,11 @@
         real_type *_ppos
         )
     {
+    /*--------------------------- cached state, if known */
+        iptr_type _gval = find_grid(_ppos) ;
+        
+        if (_gval != _gbnd) return _gval ;
+        
     /*--------------------------- calc. axis-aligned dir. */  
         iptr_type _vdim = (iptr_type)+0;
         iptr_type _sign = (iptr_type)+0;
@@ -1446,9 +1751,9 @@
             {
         /*----------------------- random search direction */
             _rvec[0] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             _rvec[1] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             
             _rvec[0]-= (real_type)+.5 ;
             _rvec[1]-= (real_type)+.5 ;
@@ -1530,9 +1835,9 @@
             {
         /*----------------------- random search direction */
             _rvec[0] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             _rvec[1] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             
             _rvec[0]-= (real_type)+.5 ;
             _rvec[1]-= (real_type)+.5 ;
@@ -312,6 +312,9 @@
     typedef containers::array   <
                 bbox_bnds ,
                 allocator       >   bbox_list ;
+    
+    typedef containers::fixed_array <
+                iptr_type , 3   >   grid_dims ;
         
     typedef mesh::tria_complex_2<
                 node_type,
@@ -335,6 +338,9 @@
                 allocator       >   tree_type ;
 
     iptr_type static constexpr _nbox = 4 ;
+    
+    iptr_type static constexpr _gbnd =-2 ;
+    iptr_type static constexpr _gnul =-3 ;
 
     public  :
     
@@ -353,6 +359,13 @@
 
     tree_type                      _ebox ;
     tree_type                      _tbox ;
+    
+    algorithms::rand_gen           _rand ;
+    
+    grid_dims                      _gnum ;
+    bbox_bnds                      _gmin ;
+    bbox_bnds                      _glen ;
+    iptr_list                      _gtag ;
 
     public  :
     
@@ -374,7 +387,9 @@
             _pmax(    _asrc ) ,
             _tria(    _asrc ) ,
             _ebox(    _asrc ) ,
-            _tbox(    _asrc )
+            _tbox(    _asrc ) ,
+            _rand(       +1 ) ,
+            _gtag(    _asrc )
         {
         }
     
@@ -1285,6 +1300,12 @@
                   this->_tbox,
        _BTOL,this->_nbox,tri3_pred () 
                  ) ;
+                 
+        this->_ebox.freeze() ;  // cache-linear queries
+        this->_tbox.freeze() ;
+        
+    /*-------------------- bg. grid of IS-INSIDE states */
+        init_grid (_BTOL);
     }
 
     /*
@@ -2131,6 +2152,328 @@
         return (   _func._find ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     * INIT-GRID: cache IS-INSIDE state on a bg. grid.
+    --------------------------------------------------------
+     */
+     
+    class grid_pred
+        {
+    /*------------------ TRUE if any tria overlaps a cell */
+        public  :
+        real_type      _rmin[3] ;
+        real_type      _rmax[3] ;
+        
+        geom_type     &_geom ;
+        
+        bool_type      _find ;
+        
+        public  :
+        
+        grid_pred operator = (
+            grid_pred & 
+            )                   =     delete ;
+        grid_pred operator = (
+            grid_pred&& 
+            )                   =     delete ;
+        
+        public  :
+    /*------------------------- construct from _src. obj. */
+        __normal_call grid_pred (
+            real_type *_lsrc ,
+            real_type *_rsrc ,
+            geom_type &_gsrc
+            ) : _geom( _gsrc)
+        {
+            this->_rmin[0] = _lsrc[0];
+            this->_rmin[1] = _lsrc[1];
+            this->_rmin[2] = _lsrc[2];
+            
+            this->_rmax[0] = _rsrc[0];
+            this->_rmax[1] = _rsrc[1];
+            this->_rmax[2] = _rsrc[2];
+            
+            this->_find    = false ;
+        }
+    /*----------------------- tria-rect overlap: aabb's + *
+     * face plane. Conservative, as edge-axes are *not*  *
+     * tested, but never misses a true overlap.          */
+        __normal_call  void_type operator()  (
+            typename  
+            tree_type::item_data *_iptr
+            )
+        {
+            for ( ; _iptr != nullptr && 
+                       !this->_find ; 
+                        _iptr = _iptr->_next )
+            {
+                iptr_type  _tpos = 
+                    _iptr->_data.ipos() ;
+                
+                real_type *_ipos = &_geom._tria.
+                    _set1[_geom._tria.
+                    _set3[_tpos].node(0)].pval(0);
+                real_type *_jpos = &_geom._tria.
+                    _set1[_geom._tria.
+                    _set3[_tpos].node(1)].pval(0);
+                real_type *_kpos = &_geom._tria.
+                    _set1[_geom._tria.
+                    _set3[_tpos].node(2)].pval(0);
+                
+            /*--------------- test tria aabb against rect */
+                bool_type _miss = false ;
+                for (auto _idim = 3; _idim-- != 0; )
+                {
+                if (std::max(_ipos[_idim], 
+                    std::max(_jpos[_idim],
+                             _kpos[_idim])) 
+                        < this->_rmin[_idim] ||
+                    std::min(_ipos[_idim], 
+                    std::min(_jpos[_idim],
+                             _kpos[_idim])) 
+                        > this->_rmax[_idim] )
+                    _miss = true ;
+                }
+                
+                if (_miss) continue ;
+                
+            /*--------------- test tria plane about rect */
+                real_type _avec[3], _bvec[3] ;
+                real_type _nvec[3] ;
+                geometry::vector_3d(
+                    _ipos, _jpos, _avec) ;
+                geometry::vector_3d(
+                    _ipos, _kpos, _bvec) ;
+                geometry::cross_3d(
+                    _avec, _bvec, _nvec) ;
+                
+                real_type _rrad = (real_type)0. ;
+                real_type _dval = (real_type)0. ;
+                for (auto _idim = 3; _idim-- != 0; )
+                {
+                real_type _rmid = (real_type).5 * (
+                    this->_rmin[_idim] + 
+                    this->_rmax[_idim] ) ;
+                real_type _rlen = (real_type).5 * (
+                    this->_rmax[_idim] - 
+                    this->_rmin[_idim] ) ;
+                    
+                _rrad += _rlen * 
+                    std::abs(_nvec[_idim]) ;
+                _dval += _nvec[_idim] * 
+                    (_rmid - _ipos[_idim]) ;
+                }
+                
+                if (std::abs(_dval) <= _rrad) 
+                    this->_find = true ;
+            }
+        }
+        
+        } ;
+    
+    __normal_call void_type init_grid (
+        real_type *_BTOL
+        )
+    {
+        iptr_type static constexpr _GMAX = 128 ;
+        
+    /*------------------ tree-rect intersection predicate */
+        typedef 
+        geom_tree::aabb_pred_rect_k <
+             real_type, 
+             iptr_type, 
+             +3        >  tree_pred ; 
+        
+        iptr_list _cell, _work ;
+        
+        this->_gtag.clear() ;
+        
+        real_type _blen[3] = {
+            this->_bmax[0] - this->_bmin[0] ,
+            this->_bmax[1] - this->_bmin[1] ,
+            this->_bmax[2] - this->_bmin[2] 
+            } ;
+        
+        if (!(_blen[0] > (real_type)0.) ||
+            !(_blen[1] > (real_type)0.) ||
+            !(_blen[2] > (real_type)0.) )
+            return ;        // degenerate or empty
+        
+    /*------------------ approx. 4 cells per indexed tria */
+        real_type _ncel = (real_type)4. * 
+        std::max((real_type)1., (real_type)
+            this->_tria._set3.count()) ;
+        
+        real_type _hlen = std::cbrt (
+            _blen[0] * _blen[1] * 
+            _blen[2] / _ncel ) ;
+        
+        for (auto _idim = 3; _idim-- != 0; )
+        {
+            iptr_type _nnum = (iptr_type)
+                std::ceil(_blen[_idim]/_hlen) ;
+            
+            _nnum = std::max(_nnum, +1) ;
+            _nnum = std::min(_nnum, _GMAX) ;
+        
+            this->_gnum[_idim] = _nnum ;
+            this->_gmin[_idim] = 
+                this->_bmin[_idim] ;
+            this->_glen[_idim] = 
+                _blen[_idim] / _nnum ;
+        }
+        
+        iptr_type _xnum = this->_gnum[0] ;
+        iptr_type _ynum = this->_gnum[1] ;
+        iptr_type _znum = this->_gnum[2] ;
+        
+        iptr_type _xynm = _xnum * _ynum ;
+        
+    /*------------------ mark cells cut by any geom. face */
+        _cell.set_count(_xynm * _znum, 
+            containers::tight_alloc, 
+           (iptr_type)_gnul) ;
+        
+        for (auto _kpos = 0; _kpos < _znum; ++_kpos)
+        for (auto _jpos = 0; _jpos < _ynum; ++_jpos)
+        for (auto _ipos = 0; _ipos < _xnum; ++_ipos)
+        {
+            real_type _rmin[3] = {
+            _gmin[0] + _ipos * _glen[0] 
+                - _BTOL[0] ,
+            _gmin[1] + _jpos * _glen[1] 
+                - _BTOL[1] ,
+            _gmin[2] + _kpos * _glen[2] 
+                - _BTOL[2]
+                } ;
+            real_type _rmax[3] = {
+            _gmin[0] + (_ipos+1) * _glen[0] 
+                + _BTOL[0] ,
+            _gmin[1] + (_jpos+1) * _glen[1] 
+                + _BTOL[1] ,
+            _gmin[2] + (_kpos+1) * _glen[2] 
+                + _BTOL[2]
+                } ;
+        
+            tree_pred _pred(_rmin, _rmax) ;
+            grid_pred _func(_rmin, _rmax, 
+                            *this ) ;
+        
+            this->_tbox.find(_pred,_func) ;
+            
+            if (_func._find)
+            _cell[_kpos*_xynm +
+                  _jpos*_xnum + _ipos] = _gbnd;
+        }
+        
+    /*------------------ flood-fill face-free components: *
+     * state is const. away from faces, so one ray-cast  *
+     * test per component fixes every cell within it.   */
+        for (auto _iter = _cell.count(); 
+                  _iter-- != 0 ; )
+        {
+            if (_cell[_iter] != _gnul) continue ;
+            
+            iptr_type _ipos = 
+           (iptr_type)_iter % _xnum ;
+            iptr_type _jpos = 
+           (iptr_type)_iter % _xynm / _xnum ;
+            iptr_type _kpos = 
+           (iptr_type)_iter / _xynm ;
+            
+            real_type _pmid[3] = {
+            _gmin[0] + (_ipos+.5) * _glen[0] ,
+            _gmin[1] + (_jpos+.5) * _glen[1] ,
+            _gmin[2] + (_kpos+.5) * _glen[2]
+                } ;
+            
+            iptr_type _itag = 
+                this->is_inside(_pmid) ;
+            
+            _cell[_iter] = _itag ;
+            _work.push_tail((iptr_type)_iter) ;
+            
+            while (!_work.empty())
+            {
+                iptr_type _cpos = 
+                   *_work.tail() ;
+                _work._pop_tail() ;
+                
+                _ipos = _cpos % _xnum ;
+                _jpos = _cpos % _xynm / _xnum ;
+                _kpos = _cpos / _xynm ;
+                
+                iptr_type _next[6] = {
+                    _ipos > +0 ? _cpos-1 : -1 ,
+                    _ipos < _xnum-1 ?
+                        _cpos+1 : -1 ,
+                    _jpos > +0 ? 
+                        _cpos-_xnum : -1 ,
+                    _jpos < _ynum-1 ?
+                        _cpos+_xnum : -1 ,
+                    _kpos > +0 ? 
+                        _cpos-_xynm : -1 ,
+                    _kpos < _znum-1 ?
+                        _cpos+_xynm : -1 
+                    } ;
+                
+                for (auto _inxt = 6; _inxt-- != 0; )
+                {
+                    iptr_type _npos = _next[_inxt] ;
+                    if (_npos < +0) continue ;
+                    
+                    if (_cell[_npos] == _gnul)
+                    {
+                        _cell[_npos] = _itag ;
+                        _work.push_tail(_npos) ;
+                    }
+                }
+            }
+        }
+        
+        this->_gtag = std::move(_cell) ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * FIND-GRID: cached IS-INSIDE state, or _GBND if the
+     * cell is cut by the geom., or lies outside the grid.
+    --------------------------------------------------------
+     */
+    
+    __inline_call iptr_type find_grid (
+        real_type *_ppos
+        )
+    {
+        if (this->_gtag.empty()) return _gbnd ;
+        
+        real_type _xval = (_ppos[0] - 
+            this->_gmin[0]) / this->_glen[0] ;
+        real_type _yval = (_ppos[1] - 
+            this->_gmin[1]) / this->_glen[1] ;
+        real_type _zval = (_ppos[2] - 
+            this->_gmin[2]) / this->_glen[2] ;
+        
+        if (!(_xval >= (real_type)0.) ||
+            !(_yval >= (real_type)0.) ||
+            !(_zval >= (real_type)0.) )
+            return _gbnd ;
+        
+        if (!(_xval < (real_type)_gnum[0]) ||
+            !(_yval < (real_type)_gnum[1]) ||
+            !(_zval < (real_type)_gnum[2]) )
+            return _gbnd ;
+        
+        iptr_type _ipos = (iptr_type)_xval ;
+        iptr_type _jpos = (iptr_type)_yval ;
+        iptr_type _kpos = (iptr_type)_zval ;
+        
+        return this->_gtag[
+            _kpos * _gnum[0] * _gnum[1] + 
+            _jpos * _gnum[0] + _ipos] ;
+    }
+    
     /*
     --------------------------------------------------------
      * IS-INSIDE: TRUE if point is "inside" geometry.
@@ -2160,6 +2503,11 @@
         real_type *_ppos
         )
     {
+    /*--------------------------- cached state, if known */
+        iptr_type _gval = find_grid(_ppos) ;
+        
+        if (_gval != _gbnd) return _gval ;
+        
     /*--------------------------- calc. axis-aligned dir. */  
         iptr_type _vdim = (iptr_type)+0;
         iptr_type _sign = (iptr_type)+0;
@@ -2239,11 +2587,11 @@
             {
         /*----------------------- random search direction */
             _rvec[0] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             _rvec[1] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             _rvec[2] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             
             _rvec[0]-= (real_type)+.5 ;
             _rvec[1]-= (real_type)+.5 ;
@@ -2334,11 +2682,11 @@
             {
         /*----------------------- random search direction */
             _rvec[0] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             _rvec[1] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             _rvec[2] = 
-        ((real_type)std::rand()) / RAND_MAX ;
+        (real_type)this->_rand.real_01() ;
             
             _rvec[0]-= (real_type)+.5 ;
             _rvec[1]-= (real_type)+.5 ;
@@ -54,6 +54,7 @@
 #   include "geom_base/vect_base_k.hpp"
 
 #   include "geom_base/geom_pred_k.hpp"
+#   include "geom_base/pred_stat_k.hpp"
 
 #   include "geom_base/intersect_k.hpp"
 
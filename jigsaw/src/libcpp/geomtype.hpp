@@ -56,6 +56,7 @@
     }
  
 #   include "containers.hpp"
+#   include "algorithms.hpp"
 
 #   include "geometry.hpp"
 
@@ -1,41 +1,433 @@
 
+    /*
+    --------------------------------------------------------
+     * HJ-SOLVER-2: "fast-marching" |dh/dx| limiter.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * The limiter solves |dh/dx| <= DFDX as a "fast-march-
+     * ing" type eikonal problem. Nodes are "accepted" in
+     * ascending order of h(x) from a priority-queue, with
+     * each accepted node used to update the values at its
+     * un-accepted neighbours. Updates are computed via a
+     * "cell-based" upwind solve over adj. triangles when
+     * a 2nd accepted node is available, falling back to a
+     * simple "edge-based" bound otherwise. Each node is
+     * popped exactly once, giving an O(N*log(N)) scheme.
+     *
+     * P.O. Persson, (2006): "Mesh size functions for
+     * implicit geometries and PDE-based gradient limiting",
+     * Engineering with Computers, 22, pp. 95-109.
+     *
+     * R. Kimmel, J.A. Sethian, (1998): "Computing geodesic
+     * paths on manifolds", Proc. of the National Academy
+     * of Sciences, 95 (15), pp. 8431-8435.
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __HJ_SOLVER_2__
+#   define __HJ_SOLVER_2__
+
+    namespace mesh {
+
+    /*
+    --------------------------------------------------------
+     * HJ-MESH-2: limiter for functions on tria. complexes.
+    --------------------------------------------------------
+     *
+     * F is an "adaptor" type, exposing the function's
+     * topology as:
+     *
+     * NODE-COUNT() : number of nodes in the complex.
+     *
+     * NODE-HVAL(I) : (write) access to the value at I.
+     *
+     * NODE-PPOS(I, P) : coord.'s of node I, as a vector
+     * in R^3 (with P[2] = 0 for 2-dim. complexes).
+     *
+     * NODE-ADJS(I, F) : call F(J, K) for each tria. (I,J,
+     * K) adj. to I, and F(J, null) for each edge (I,J) not
+     * otherwise contained in a tria.
+     *
+    --------------------------------------------------------
+     */
+
     template <
     typename F
              >
     class hj_mesh_2
     {
-    
-    __static_call 
-    __normal_call void_type limit_edge_2 (
+    public  :
+
+    typedef F                           ffun_type ;
+
+    typedef typename
+            ffun_type::real_type        real_type ;
+    typedef typename
+            ffun_type::iptr_type        iptr_type ;
+    typedef typename
+            ffun_type::allocator        allocator ;
+
+    class heap_data
+        {
+    /*----------------------- priority-queue data: (H, I) */
+        public  :
+        real_type                   _hval ;
+        iptr_type                   _node ;
+        } ;
+
+    class heap_pred
+        {
+    /*----------------------- min-heap by value: H(I)<H(J) */
+        public  :
+        __inline_call bool_type operator() (
+            heap_data const&_idat ,
+            heap_data const&_jdat
+            ) const
+        {   return _idat._hval < _jdat._hval ;
+        }
+        } ;
+
+    typedef containers::prioritymap <
+            heap_data ,
+            heap_pred ,
+            allocator >                 heap_type ;
+
+    typedef typename
+            heap_type::kptr_type        kptr_type ;
+
+    typedef containers::array <
+            kptr_type ,
+            allocator >                 kptr_list ;
+
+    char_type static constexpr _null_mark = +0 ;
+    char_type static constexpr _open_mark = +1 ;
+    char_type static constexpr _done_mark = +2 ;
+
+    typedef containers::array <
+            char_type ,
+            allocator >                 mark_list ;
+
+    /*
+    --------------------------------------------------------
+     * LIMIT-EDGE-2: edge-based update for node J.
+    --------------------------------------------------------
+     */
+
+    __static_call
+    __normal_call real_type limit_edge_2 (
+        real_type *_ipos ,
+        real_type *_jpos ,
+        real_type  _ihfn ,
+        real_type  _DFDX
         )
     {
+    /*----------------------- H(J) <= H(I) + DFDX * |IJ| */
+        real_type _dd[3] = {
+        _jpos[0] - _ipos[0] ,
+        _jpos[1] - _ipos[1] ,
+        _jpos[2] - _ipos[2] } ;
+
+        real_type _llen = std::sqrt (
+        _dd[0] * _dd[0] +
+        _dd[1] * _dd[1] +
+        _dd[2] * _dd[2] ) ;
+
+        return _ihfn + _DFDX * _llen ;
     }
-    
-    __static_call 
-    __normal_call void_type limit_tria_3 (
+
+    /*
+    --------------------------------------------------------
+     * LIMIT-TRIA-3: cell-based update for node J.
+    --------------------------------------------------------
+     */
+
+    __static_call
+    __normal_call bool_type limit_tria_3 (
+        real_type *_ipos ,
+        real_type *_kpos ,
+        real_type *_jpos ,
+        real_type  _ihfn ,
+        real_type  _khfn ,
+        real_type  _DFDX ,
+        real_type &_jhfn
         )
     {
+    /*----------------------- local basis E1, E2 about J. */
+        real_type _e1[3] = {
+        _ipos[0] - _jpos[0] ,
+        _ipos[1] - _jpos[1] ,
+        _ipos[2] - _jpos[2] } ;
+
+        real_type _e2[3] = {
+        _kpos[0] - _jpos[0] ,
+        _kpos[1] - _jpos[1] ,
+        _kpos[2] - _jpos[2] } ;
+
+        real_type _g11 =
+            _e1[0] * _e1[0] +
+            _e1[1] * _e1[1] +
+            _e1[2] * _e1[2] ;
+        real_type _g22 =
+            _e2[0] * _e2[0] +
+            _e2[1] * _e2[1] +
+            _e2[2] * _e2[2] ;
+        real_type _g12 =
+            _e1[0] * _e2[0] +
+            _e1[1] * _e2[1] +
+            _e1[2] * _e2[2] ;
+
+        real_type static const _RTOL =
+            std::pow (
+        std::numeric_limits<real_type>
+            ::epsilon(),(real_type).8) ;
+
+    /*----------------------- det(G): reject "flat" cells */
+        real_type _gdet =
+            _g11 * _g22 - _g12 * _g12 ;
+
+        if (_gdet <= _RTOL * _g11 * _g22)
+            return false ;
+
+    /*----------------------- solve v'*inv(G)*v = DFDX^2,
+       where v = [H(I)-H(J), H(K)-H(J)] is the change in
+       H along E1, E2 -- as a quad. in H(J), scaled by
+       det(G) throughout.                             */
+        real_type _aa =
+            _g11 + _g22 - _g12 * 2. ;
+        real_type _bb =
+            _g22 * _ihfn +
+            _g11 * _khfn -
+            _g12 *(_ihfn + _khfn) ;
+        real_type _cc =
+            _g22 * _ihfn * _ihfn +
+            _g11 * _khfn * _khfn -
+            _g12 * _ihfn * _khfn * 2. -
+            _DFDX* _DFDX * _gdet ;
+
+        real_type _disc =
+            _bb * _bb - _aa * _cc ;
+
+        if (_aa  <= (real_type)+0.)
+            return false ;
+        if (_disc < (real_type)+0.)
+            return false ;
+
+        real_type _hval =
+           (_bb + std::sqrt(_disc)) / _aa ;
+
+    /*----------------------- upwind: grad. must point in */
+        real_type _vi = _ihfn - _hval ;
+        real_type _vk = _khfn - _hval ;
+
+        if (_g22 * _vi - _g12 * _vk >
+                (real_type)+0.)
+            return false ;
+        if (_g11 * _vk - _g12 * _vi >
+                (real_type)+0.)
+            return false ;
+
+        _jhfn = _hval ; return  true ;
     }
-    
+
+    /*
+    --------------------------------------------------------
+     * LIMIT-NODE: update nodes adj. to accepted node.
+    --------------------------------------------------------
+     */
+
+    class limit_node
+        {
+        public  :
+        ffun_type                  *_ffun ;
+        heap_type                  *_heap ;
+        kptr_list                  *_kptr ;
+        mark_list                  *_mark ;
+
+        iptr_type                   _inod ;
+        real_type                   _DFDX ;
+
+        public  :
+        __inline_call void_type limit_hfun (
+            iptr_type  _jnod ,
+            iptr_type  _knod
+            )
+        {
+            if ((*this->_mark)[_jnod]
+                    == _done_mark) return ;
+
+            real_type _ipos[3] ;
+            real_type _jpos[3] ;
+            this->
+           _ffun->node_ppos(_inod, _ipos);
+            this->
+           _ffun->node_ppos(_jnod, _jpos);
+
+            real_type _ihfn = this->
+           _ffun->node_hval(_inod) ;
+            real_type _jhfn = this->
+           _ffun->node_hval(_jnod) ;
+
+        /*--------------------- edge-based bound on H(J) */
+            real_type _hnew = limit_edge_2 (
+                _ipos, _jpos,
+                _ihfn, this->_DFDX) ;
+
+        /*--------------------- cell-based bound on H(J) */
+            if (_knod >= +0 &&
+               (*this->_mark)[_knod]
+                    == _done_mark)
+            {
+                real_type _kpos[3] ;
+                this->
+               _ffun->node_ppos(_knod, _kpos);
+
+                real_type _khfn = this->
+               _ffun->node_hval(_knod) ;
+
+                real_type _hval ;
+                if (limit_tria_3 (
+                    _ipos, _kpos, _jpos,
+                    _ihfn, _khfn,
+                    this->_DFDX , _hval) )
+                {
+                    _hnew =
+                    std::min(_hnew, _hval) ;
+                }
+            }
+
+            if (_hnew < _jhfn)
+            {
+        /*--------------------- push updates onto queue */
+                this->
+               _ffun->node_hval(_jnod) = _hnew;
+
+                heap_data _hdat;
+                _hdat._node = _jnod ;
+                _hdat._hval = _hnew ;
+
+                this->_heap->update (
+               (*this->_kptr)[_jnod], _hdat) ;
+            }
+        }
+
+        __inline_call void_type operator() (
+            iptr_type  _jnod ,
+            iptr_type  _knod
+            )
+        {
+        /*--------------------- update both J, K via cell */
+            limit_hfun(_jnod, _knod) ;
+
+            if (_knod >= +0)
+            limit_hfun(_knod, _jnod) ;
+        }
+        } ;
+
+    /*
+    --------------------------------------------------------
+     * LIMIT-MESH: limit |dh/dx| over the full complex.
+    --------------------------------------------------------
+     */
+
     __static_call
     __normal_call void_type limit_mesh (
         ffun_type &_ffun,
         real_type  _DFDX
         )
     {
-    
-        containers::priority_map<> _sort;
-    
-        // push nodes onto pq
-        // pop min at each pass
-        // limit any cell neighbours
-        // if a cell is limited, update pq of its nodes
-        
-        // that's it!
-    
+        heap_type  _heap ;
+        kptr_list  _kptr ;
+        mark_list  _mark ;
+
+        if (_DFDX <= (real_type) +0.) return ;
+        if (_DFDX >=
+            +std::numeric_limits
+                <real_type>::infinity())
+            return ;
+
+        iptr_type _nnod = _ffun.node_count() ;
+
+        _kptr.set_count(_nnod ,
+            containers::tight_alloc , +0) ;
+        _mark.set_count(_nnod ,
+            containers::tight_alloc ,
+                (char_type)_null_mark) ;
+
+    /*----------------------- push nodes onto the p-queue */
+        _heap._heap.set_alloc(_nnod) ;
+        _heap._keys.set_alloc(_nnod) ;
+
+        for (auto _inod = +0 ;
+                  _inod < _nnod; ++_inod)
+        {
+            heap_data _hdat ;
+            _hdat._node = _inod ;
+            _hdat._hval =
+            _ffun.node_hval(_inod) ;
+
+           _kptr[_inod] =
+           _heap.push(_hdat) ;
+           _mark[_inod] = _open_mark ;
+        }
+
+    /*----------------------- pop min, update neighbours */
+        limit_node _func ;
+        _func._ffun = &_ffun ;
+        _func._heap = &_heap ;
+        _func._kptr = &_kptr ;
+        _func._mark = &_mark ;
+        _func._DFDX =  _DFDX ;
+
+        for ( ; !_heap.empty() ; )
+        {
+            heap_data _hdat ;
+            _heap._pop_root(_hdat) ;
+
+            _mark[_hdat._node] = _done_mark ;
+
+            _func._inod = _hdat._node ;
+
+            _ffun.node_adjs(
+                _hdat._node, _func) ;
+        }
     }
-     
+
     } ;
-    
-    
-    
+
+
+    }
+
+#   endif   //__HJ_SOLVER_2__
+
+
+
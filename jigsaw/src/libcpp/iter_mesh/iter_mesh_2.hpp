@@ -88,6 +88,8 @@
             ::array< iptr_type >        iptr_list ;        
     typedef containers
             ::array< real_type >        real_list ;
+            
+    typedef algorithms::rand_gen        rand_type ;
     
     public  :
     
@@ -753,6 +755,7 @@
         mesh_type &_mesh ,
         size_type &_hfun ,
         pred_type &_pred ,
+        rand_type &_rand ,
         real_list &_hval ,
         real_list &_qscr ,
         iptr_list &_nset ,
@@ -940,7 +943,7 @@
            (size_t) (_aset.tend()-_iter) ) ;
         
             auto _next = _iter + 
-                std::rand() % _sift ;
+                _rand () % _sift ;
             
             std::swap(*_iter,*_next);          
         }                   
@@ -948,6 +951,480 @@
       
     }
     
+    /*
+    --------------------------------------------------------
+     * TRIA-STEP: attempt to move node wrt. TRIA geom.
+    --------------------------------------------------------
+     */
+    
+    template <
+        typename  node_iter
+             >
+    __static_call
+    __normal_call void_type tria_step (
+        geom_type &_geom ,
+        mesh_type &_mesh ,
+        size_type &_hfun ,
+        pred_type &_pred ,
+        real_list &_hval ,
+        iter_opts &_opts ,
+        node_iter  _node ,
+        bool_type &_okay ,
+        iptr_list &_tset ,
+        real_list &_told ,
+        real_list &_tnew ,
+        real_list &_dold ,
+        real_list &_dnew ,
+        real_type  _TLIM ,
+        real_type  _DLIM
+        )
+    {
+        _told.set_count( +0);
+        _tnew.set_count( +0);
+        _dold.set_count( +0);
+        _dnew.set_count( +0);
+           
+        real_type _TMIN = 
+            loop_tscr( _mesh, 
+                _pred, _tset, _told);
+
+        real_type _DMIN = 
+            loop_dscr( _mesh, 
+                _pred, _tset, _dold);
+
+        _okay = false ;
+
+        if(!_okay)
+        {
+    /*---------------- attempt a CCVT-style smoothing */
+            move_node( _geom, _mesh ,
+                _hfun, _pred, _hval , 
+                _opts, _node, +1    , 
+                _okay, _tset, 
+                _told, _tnew,
+                _dold, _dnew, 
+                _TMIN, _TLIM,
+                _DMIN, _DLIM ) ;
+        }
+        if(!_okay)
+        {
+    /*---------------- attempt a GRAD-based smoothing */
+            move_node( _geom, _mesh ,
+                _hfun, _pred, _hval , 
+                _opts, _node, +2    , 
+                _okay, _tset, 
+                _told, _tnew,
+                _dold, _dnew, 
+                _TMIN, _TLIM,
+                _DMIN, _DLIM ) ;
+        }
+    }
+    
+    /*
+    --------------------------------------------------------
+     * DUAL-STEP: attempt to move node wrt. DUAL geom.
+    --------------------------------------------------------
+     */
+    
+    template <
+        typename  node_iter
+             >
+    __static_call
+    __normal_call void_type dual_step (
+        geom_type &_geom ,
+        mesh_type &_mesh ,
+        size_type &_hfun ,
+        pred_type &_pred ,
+        real_list &_hval ,
+        iter_opts &_opts ,
+        node_iter  _node ,
+        bool_type &_okay ,
+        iptr_list &_tset ,
+        real_list &_dold ,
+        real_list &_dnew ,
+        real_type  _DLIM
+        )
+    {
+        _dold.set_count( +0);
+        _dnew.set_count( +0);
+        
+        real_type _DMIN = 
+            loop_dscr( _mesh, 
+                _pred, _tset, _dold);
+        
+        _okay = false ;
+        
+        if(!_okay)
+        {
+    /*---------------- attempt a GRAD-based smoothing */
+            move_dual( _geom, _mesh ,
+                _hfun, _pred, _hval , 
+                _opts, _node, 
+                _okay, _tset, 
+                _dold, _dnew, 
+                _DMIN, _DLIM ) ;
+        }  
+    }
+    
+    /*
+    --------------------------------------------------------
+     * MARK-MOVE: push moved node onto the active set.
+    --------------------------------------------------------
+     */
+    
+    __static_call
+    __inline_call void_type mark_move (
+        iptr_list &_nset ,
+        iptr_list &_nmrk ,
+        iptr_type  _iout ,
+        iptr_type  _inod ,
+        iptr_type &_nmov
+        )
+    {
+        if (std::abs(
+           _nmrk[_inod]) != _iout)
+        {
+            if (_nmrk[_inod] >= 0)
+            _nmrk[_inod] = +_iout;
+            else
+            _nmrk[_inod] = -_iout;
+            
+            _nset.push_tail(_inod) ;
+        }
+        
+        _nmov += +1 ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * EVAL-HFUN: eval. H(X) at a set of nodes, as batch.
+    --------------------------------------------------------
+     */
+    
+    __static_call
+    __normal_call void_type eval_hfun (
+        mesh_type &_mesh ,
+        size_type &_hfun ,
+        iptr_list &_nset ,
+        real_list &_hval
+        )
+    {
+        iptr_type _npts = 
+       (iptr_type)_nset.count() ;
+    
+        if (_npts == +0) return ;
+        
+        real_list _ppos, _hbuf ;
+        iptr_list _hint ;
+        _ppos.set_count(_npts * _dims) ;
+        _hbuf.set_count(_npts * +1) ;
+        _hint.set_count(_npts * +1) ;
+        
+    /*-------------------- gather coord. + hints, as SoA */
+        for (auto _ipos = +0; _ipos < _npts; ++_ipos)
+        {
+            iptr_type _node = _nset[_ipos] ;
+            
+            for (auto _idim = +0; 
+                _idim < _dims; ++_idim)
+            {
+            _ppos[_ipos * _dims + _idim] = 
+                _mesh._set1[_node].pval(_idim) ;
+            }
+            
+            _hint[_ipos] = 
+                _mesh._set1[_node].hidx() ;
+        }
+        
+        _hfun.eval(_npts, &_ppos[0], 
+                   &_hbuf[0], &_hint[0]) ;
+        
+    /*-------------------- scatter values + hints back */
+        for (auto _ipos = +0; _ipos < _npts; ++_ipos)
+        {
+            iptr_type _node = _nset[_ipos] ;
+            
+            _hval[_node] = _hbuf[_ipos] ;
+            
+            _mesh._set1[_node].hidx() 
+                = _hint[_ipos] ;
+        }
+    }
+    
+#   ifdef  __use_openmp
+
+    /*
+    --------------------------------------------------------
+     * COLOR-NODE: greedy independent-set colouring.
+    --------------------------------------------------------
+     */
+    
+    __static_call
+    __normal_call void_type color_node (
+        mesh_type &_mesh ,
+        iptr_list &_aset ,
+        iptr_list &_cptr ,
+        iptr_list &_cset
+        )
+    {
+    /*-------------------- colour nodes in permuted order */
+        iptr_list _eset, _ncol, _used ;
+        _ncol.set_count(
+            _mesh._set1.count(), 
+        containers::tight_alloc, (iptr_type)-1 );
+        
+        iptr_type _cnum = +0 ;
+        for (auto _apos  = _aset.head() ;
+                  _apos != _aset.tend() ;
+                ++_apos  )
+        {
+            _eset.set_count(0) ;
+            
+            _mesh.node_edge (
+                   *_apos, _eset) ;
+        
+        /*---------------- find min. colour not in 1-ring */
+            for (auto _edge  = _eset.head();
+                      _edge != _eset.tend();
+                    ++_edge  )
+            {
+                 auto _eptr = 
+                _mesh._set2.head() + *_edge;
+                
+                iptr_type _jnod = 
+                    _eptr->node(0) != *_apos ? 
+                    _eptr->node(0) :
+                    _eptr->node(1) ;
+                    
+                iptr_type _jcol = _ncol[_jnod];
+                
+                if (_jcol >= +0)
+                _used[_jcol] = *_apos ;
+            }
+            
+            iptr_type _icol  = +0 ;
+            for ( ; _icol < _cnum ; ++_icol)
+            {
+                if (_used[_icol] != *_apos) break ;
+            }
+            
+            if (_icol == _cnum)
+            {
+                _cnum += +1 ;
+                _used.push_tail(-1) ;
+            }
+            
+            _ncol[*_apos] = _icol ;
+        }
+        
+    /*-------------------- bucket sets, stable wrt. order */
+        _cptr.set_count(_cnum + 1, 
+        containers::tight_alloc, (iptr_type)+0 );
+        
+        for (auto _apos  = _aset.head() ;
+                  _apos != _aset.tend() ;
+                ++_apos  )
+        {
+            _cptr[_ncol[*_apos] + 1] += 1 ;
+        }
+        
+        for (auto _icol = +0; _icol < _cnum; ++_icol)
+        {
+            _cptr[_icol+1] += _cptr[_icol] ;
+        }
+        
+        _cset.set_count(_aset.count()) ;
+        
+        _used.set_count(_cnum) ;
+        for (auto _icol = +0; _icol < _cnum; ++_icol)
+        {
+            _used[_icol] = _cptr[_icol] ;
+        }
+        
+        for (auto _apos  = _aset.head() ;
+                  _apos != _aset.tend() ;
+                ++_apos  )
+        {
+            _cset[_used[_ncol[*_apos]]++] = *_apos ;
+        }
+    }
+    
+    /*
+    --------------------------------------------------------
+     * MOVE-COLS: smooth each independent set in parallel.
+    --------------------------------------------------------
+     */
+    
+    __static_call 
+    __normal_call void_type move_cols (
+        geom_type &_geom ,
+        mesh_type &_mesh ,
+        size_type &_hfun ,
+        pred_type &_pred ,
+        real_list &_hval ,
+        iptr_list &_nset ,
+        iptr_list &_aset ,
+        iptr_list &_nmrk ,
+        iptr_type  _iout , 
+        iter_opts &_opts ,
+        iptr_type &_nmov , 
+        real_type  _TLIM ,
+        real_type  _DLIM
+        )
+    {
+    /*-------------------- nodes in the same colour share
+        no edges, so their 1-ring stencils are disjoint
+        in "moving" nodes, and can be updated concurrently.
+        Results depend only on the colouring, which is
+        formed serially in the (sorted) order of ASET.
+     */
+        iptr_list _cptr, _cset, _tptr, _tall ;
+        iptr_list _tloc, _okay, _hnod ;
+        
+        color_node(_mesh, _aset, _cptr, _cset) ;
+        
+        _okay.set_count(_cset.count(), 
+        containers::tight_alloc, (iptr_type)+0 );
+        
+        for (auto _pass = +0; _pass < +2; ++_pass)
+        {
+            if (_pass == +0 && !_opts.dual()) continue ;
+            if (_pass == +1 && !_opts.tria()) continue ;
+        
+            for (auto _icol = +0; 
+                _icol < (iptr_type)_cptr.count()-1; 
+                    ++_icol)
+            {
+                iptr_type _ihead = _cptr[_icol+0] ;
+                iptr_type _itend = _cptr[_icol+1] ;
+            
+        /*---------------- assemble stencils: mesh is not 
+                           re-entrant, so do this serially */
+                _tptr.set_count(0) ;
+                _tall.set_count(0) ;
+                _tptr.push_tail(0) ;
+                
+                for (auto _ipos = _ihead; 
+                          _ipos < _itend; ++_ipos)
+                {
+                    iptr_type _inod = _cset[_ipos] ;
+                    
+                    _tloc.set_count(0) ;
+                    
+                    if (_pass == +0 || 
+                        _nmrk[_inod] >= +0)
+                    _mesh.node_tri3(_inod, _tloc) ;
+                    
+                    _tall.push_tail(
+                    _tloc.head(), _tloc.tend()) ;
+                    
+                    _tptr.push_tail(
+                        (iptr_type)_tall.count());
+                }
+                
+                if (_pass == +1)
+                {
+        /*---------------- eval. H(X) as batch at stencils */
+                _hnod.set_count(0) ;
+                
+                for (auto _tria  = _tall.head() ;
+                          _tria != _tall.tend() ;
+                        ++_tria  )
+                {
+                    for (auto _inod = +3; _inod-- != +0; )
+                    {
+                    iptr_type _node = _mesh.
+                        _set3[*_tria].node(_inod) ;
+                        
+                    if (_hval[_node] < (real_type)+0.)
+                    {
+                        _hval[_node] = (real_type)+0. ;
+                        
+                        _hnod.push_tail(_node) ;
+                    }
+                    }
+                }
+                
+                eval_hfun(_mesh, _hfun, _hnod, _hval) ;
+                }
+            
+        /*---------------- move the independent set in ||  */
+                #pragma omp parallel
+                {
+                iptr_list _tset ;
+                real_list _told, _tnew ;
+                real_list _dold, _dnew ;
+                
+                #pragma omp for schedule(dynamic, +64)
+                for (iptr_type _ipos = _ihead; 
+                               _ipos < _itend; ++_ipos)
+                {
+                    iptr_type _inod = _cset[_ipos];
+                
+                     auto _node  = 
+                    _mesh._set1.head() + _inod ;
+                
+                    _okay[_ipos] = +0 ;
+                
+                    iptr_type _tnum = 
+                    _tptr[_ipos-_ihead+1] -
+                    _tptr[_ipos-_ihead+0] ;
+                
+                    if (_tnum == +0) continue ;
+                
+                    _tset.set_count(+0) ;
+                    for (auto _tpos = 
+                         _tptr[_ipos-_ihead+0] ; 
+                              _tpos < 
+                         _tptr[_ipos-_ihead+1] ; 
+                            ++_tpos )
+                    {
+                        _tset.push_tail(_tall[_tpos]);
+                    }
+                    
+                    bool_type _move = false;
+                    
+                    if (_pass == +0)
+                    {
+                    dual_step( _geom, _mesh, 
+                        _hfun, _pred, _hval,
+                        _opts, _node, 
+                        _move, _tset, 
+                        _dold, _dnew, _DLIM) ;
+                    }
+                    else
+                    {
+                    tria_step( _geom, _mesh, 
+                        _hfun, _pred, _hval,
+                        _opts, _node, 
+                        _move, _tset, 
+                        _told, _tnew, 
+                        _dold, _dnew, 
+                        _TLIM, _DLIM) ;
+                        
+                    if (_move)
+                    _hval[_inod] = (real_type)-1. ;
+                    }
+                    
+                    _okay[_ipos] = _move ? +1 : +0 ;
+                }
+                }
+                
+        /*---------------- update moves in colour order */
+                for (auto _ipos = _ihead; 
+                          _ipos < _itend; ++_ipos)
+                {
+                    if (_okay[_ipos] == +0) continue ;
+                    
+                    mark_move( _nset, _nmrk, 
+                        _iout, _cset[_ipos], _nmov) ;
+                }
+            }
+        }
+    }
+    
+#   endif//__use_openmp
+    
     /*
     --------------------------------------------------------
      * MOVE-NODE: do a single node smoothing pass.
@@ -960,6 +1437,7 @@
         mesh_type &_mesh ,
         size_type &_hfun ,
         pred_type &_pred ,
+        rand_type &_rand ,
         real_list &_hval ,
         real_list &_qscr ,
         iptr_list &_nset ,
@@ -986,10 +1464,24 @@
             
     /*-------------------- permute nodes for optimisation */
         sort_node( _geom, _mesh, _hfun, 
-            _pred, _hval, _qscr, 
+            _pred, _rand, _hval, _qscr, 
             _nset, _aset, 
             _amrk, _nmrk, _iout, _isub, 
             _opts, _TLIM, _DLIM ) ;
+            
+#       ifdef  __use_openmp
+        if (omp_get_max_threads() > +1)
+        {
+    /*-------------------- JACOBI-type iter. on colouring */
+            move_cols( _geom, _mesh, _hfun, 
+                _pred, _hval, _nset, 
+                _aset, _nmrk, _iout, 
+                _opts, _nmov, 
+                _TLIM, _DLIM) ;
+                
+            return ;
+        }
+#       endif//__use_openmp
     
     /*-------------------- GAUSS-SEIDEL iteration on DUAL */
         if (_opts .dual())
@@ -1010,41 +1502,19 @@
             if (_tset.empty()) continue ;
             
         /*---------------- attempt to optimise DUAL geom. */    
-            _dold.set_count( +0);
-            _dnew.set_count( +0);
-            
-            real_type _DMIN = 
-                loop_dscr( _mesh, 
-                    _pred, _tset, _dold);
-            
             bool_type _okay = false;
             
-            if(!_okay)
-            {
-        /*---------------- attempt a GRAD-based smoothing */
-                move_dual( _geom, _mesh ,
-                    _hfun, _pred, _hval , 
-                    _opts, _node, 
-                    _okay, _tset, 
-                    _dold, _dnew, 
-                    _DMIN, _DLIM ) ;
-            }  
+            dual_step( _geom, _mesh, 
+                _hfun, _pred, _hval, 
+                _opts, _node, 
+                _okay, _tset, 
+                _dold, _dnew, _DLIM) ;
                      
             if (_okay) 
             {
         /*---------------- update when state is improving */
-            if (std::abs(
-               _nmrk[*_apos]) != _iout)
-            {
-                if (_nmrk[*_apos] >= 0)
-                _nmrk[*_apos] = +_iout;
-                else
-                _nmrk[*_apos] = -_iout;
-                
-                _nset.push_tail(*_apos) ;
-            }
-            
-            _nmov += +1 ;
+                mark_move( _nset, _nmrk, 
+                    _iout, *_apos, _nmov) ;
             }
         }
         }
@@ -1070,63 +1540,23 @@
             if (_nmrk[*_apos] >= +0)
             {  
         /*---------------- attempt to optimise TRIA geom. */    
-            _told.set_count( +0);
-            _tnew.set_count( +0);
-            _dold.set_count( +0);
-            _dnew.set_count( +0);
-               
-            real_type _TMIN = 
-                loop_tscr( _mesh, 
-                    _pred, _tset, _told);
-
-            real_type _DMIN = 
-                loop_dscr( _mesh, 
-                    _pred, _tset, _dold);
-
             bool_type _okay = false;
-
-            if(!_okay)
-            {
-        /*---------------- attempt a CCVT-style smoothing */
-                move_node( _geom, _mesh ,
-                    _hfun, _pred, _hval , 
-                    _opts, _node, +1    , 
-                    _okay, _tset, 
-                    _told, _tnew,
-                    _dold, _dnew, 
-                    _TMIN, _TLIM,
-                    _DMIN, _DLIM ) ;
-            }
-            if(!_okay)
-            {
-        /*---------------- attempt a GRAD-based smoothing */
-                move_node( _geom, _mesh ,
-                    _hfun, _pred, _hval , 
-                    _opts, _node, +2    , 
-                    _okay, _tset, 
-                    _told, _tnew,
-                    _dold, _dnew, 
-                    _TMIN, _TLIM,
-                    _DMIN, _DLIM ) ;
-            }
+            
+            tria_step( _geom, _mesh, 
+                _hfun, _pred, _hval, 
+                _opts, _node, 
+                _okay, _tset, 
+                _told, _tnew,
+                _dold, _dnew, 
+                _TLIM, _DLIM) ;
                        
             if (_okay)
             {
         /*---------------- update when state is improving */
-            _hval[*_apos] = (real_type)-1. ;
+                _hval[*_apos] = (real_type)-1. ;
         
-            if (std::abs(
-               _nmrk[*_apos]) != _iout)
-            {
-                if (_nmrk[*_apos] >= 0)
-                _nmrk[*_apos] = +_iout;
-                else
-                _nmrk[*_apos] = -_iout;
-                
-                _nset.push_tail(*_apos) ;
-            }
-            
-            _nmov += +1 ;
+                mark_move( _nset, _nmrk, 
+                    _iout, *_apos, _nmov) ;
             }
             }
         }     
@@ -1148,6 +1578,7 @@
         mesh_type &_mesh ,
         size_type &_hfun ,
         pred_type &_pred ,
+        rand_type &_rand ,
         iptr_type  _tria ,
         bool_type &_flip , 
         iptr_list &_told ,
@@ -1159,7 +1590,7 @@
         _flip  = false ;
     
          auto 
-        _coin  = std::rand() % +3 ;
+        _coin  = _rand () % +3 ;
     
         if (_coin == +0)
         {
@@ -1243,6 +1674,7 @@
         mesh_type &_mesh ,
         size_type &_hfun ,
         pred_type &_pred , 
+        rand_type &_rand ,
         iptr_list &_nset ,
         iptr_list &_nmrk ,
         iptr_list &_emrk ,
@@ -1296,7 +1728,7 @@
             {           
                 bool_type  _flip = false ;
                 flip_tria( _geom, _mesh, 
-                    _hfun, _pred,
+                    _hfun, _pred, _rand,
                    *_tria, _flip, 
                     _told, _tnew, 
                     _qold, _qnew );
@@ -1330,6 +1762,7 @@
         mesh_type &_mesh , 
         size_type &_hfun ,
         pred_type &_pred , 
+        rand_type &_rand ,
         real_list &_hval ,
         iptr_list &_nset ,
         iptr_list &_nmrk ,
@@ -1405,7 +1838,7 @@
                     (iptr_type)_node, _eset) ;
         
             /*------------------- "weak" stochastic order */
-                if (std::rand() % +2 == +0 )
+                if (_rand () % +2 == +0 )
                 {
                     _head = _eset.head() ;
                     _tend = _eset.tend() ;
@@ -1585,6 +2018,8 @@
         )
     {
         iter_stat  _tcpu ;
+        
+        _tcpu.pred_init() ;
     
     /*------------------------------ push log-file header */
         _dump.push (
@@ -1605,7 +2040,7 @@
     #   endif//__use_timers
     
     /*------------------------------ ensure deterministic */  
-        std::srand( +1 ) ;
+        rand_type  _rand(+1) ;
     
     /*------------------------------ push boundary marker */    
         iptr_list _nmrk, _emrk, _tmrk, 
@@ -1724,7 +2159,7 @@
             
                 iptr_type  _nloc;
                 move_node( _geom, _mesh ,
-                    _hfun, _pred, 
+                    _hfun, _pred, _rand,
                     _hval, _qmin, 
                     _nset, _amrk,
                     _nmrk, _emrk, _tmrk , 
@@ -1755,7 +2190,8 @@
                 " CALL FLIP-MESH...\n") ;
                     
                 flip_mesh( _geom, _mesh , 
-                    _hfun, _pred, _nset ,
+                    _hfun, _pred, _rand ,
+                    _nset ,
                     _nmrk, _emrk, _tmrk , 
                     _iter, _nflp) ;
             }
@@ -1781,7 +2217,7 @@
                 " CALL _ZIP-MESH...\n") ;
             
                 _zip_mesh( _geom, _mesh , 
-                    _hfun, _pred, 
+                    _hfun, _pred, _rand,
                     _hval, _nset, 
                     _nmrk, _emrk, _tmrk , 
                     _iter, _opts,
@@ -1833,6 +2269,8 @@
             std::to_string(_tcpu._zips_full)) ;
             _dump.push("\n");
         
+            _tcpu.pred_dump(_dump) ;
+        
             _dump.push("\n");
         }
         else
@@ -185,7 +185,7 @@
     typename R , 
     typename I
              >
-    class iter_timers
+    class iter_timers : public geompred::pred_stats
         {
         public  :
         
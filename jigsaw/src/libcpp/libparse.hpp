@@ -46,6 +46,13 @@
 #   ifndef __LIBPARSE__
 #   define __LIBPARSE__
 
+#   include <cstdint>
+#   include <cstring>
+#   include <cstdlib>
+#   include <limits>
+#   include <cmath>
+#   include <algorithm>
+
     /*
     --------------------------------------------------------
      * TRIM: trim leading and trailing "whitespace".
@@ -164,6 +171,640 @@
         }
     }
 
+    /*
+    --------------------------------------------------------
+     * SCAN-INDX: parse int. from chars, in-place.
+    --------------------------------------------------------
+     */
+     
+    __normal_call bool_type scan_indx (
+        char const      *_head,
+        char const      *_tend,
+        std::int32_t    &_ival
+        )
+    {
+        bool_type _flip = false;
+        if (_head != _tend &&
+           (*_head == '+' || *_head == '-'))
+        {
+            _flip = *_head++ == '-' ;
+        }
+        
+        if (_head == _tend) return false ;
+        
+        std::int64_t _inum = +0 ;
+        for ( ; _head != _tend; ++_head)
+        {
+            unsigned _digi = 
+           (unsigned)(*_head - '0') ;
+            
+            if (_digi > +9) return false ;
+            
+            _inum = _inum * 10 + _digi ;
+            
+            if (_inum > (std::int64_t)1 << 31)
+                return false ;
+        }
+        
+        if (_flip) _inum = -_inum ;
+        
+        if (_inum > 
+            std::numeric_limits
+                <std::int32_t>::max() )
+            return false ;
+        
+        _ival = (std::int32_t)_inum ;
+        
+        return (  true ) ;
+    }
+     
+    /*
+    --------------------------------------------------------
+     * SCAN-REAL: parse real from chars, in-place.
+    --------------------------------------------------------
+     *
+     * Values with <= 15 significant digits and a modest
+     * exponent are converted exactly (the "fast-path" of
+     * Clinger), others are handed to strtod via a local 
+     * buffer, so that results are always as per stod.
+     *
+    --------------------------------------------------------
+     */
+     
+    __normal_call bool_type scan_real (
+        char const      *_head,
+        char const      *_tend,
+        double          &_rval
+        )
+    {
+        double static const _pten[] = {
+            1.e+0 , 1.e+1 , 1.e+2 , 1.e+3 , 
+            1.e+4 , 1.e+5 , 1.e+6 , 1.e+7 , 
+            1.e+8 , 1.e+9 , 1.e+10, 1.e+11,
+            1.e+12, 1.e+13, 1.e+14, 1.e+15,
+            1.e+16, 1.e+17, 1.e+18, 1.e+19,
+            1.e+20, 1.e+21, 1.e+22
+            } ;
+    
+        char const *_bptr = _head ;
+    
+        bool_type _flip = false;
+        if (_bptr != _tend &&
+           (*_bptr == '+' || *_bptr == '-'))
+        {
+            _flip = *_bptr++ == '-' ;
+        }
+        
+    /*------------------------- mantissa: int. and frac. */
+        std::uint64_t _mant = +0 ;
+        std::int32_t  _ndig = +0 ;
+        std::int32_t  _nexp = +0 ;
+        std::int32_t  _nnum = +0 ;
+        
+        for ( ; _bptr != _tend; ++_bptr)
+        {
+            unsigned _digi = 
+           (unsigned)(*_bptr - '0') ;
+            
+            if (_digi > +9) break ;
+            
+            _nnum += +1 ;
+            if (_mant != +0 || _digi != +0)
+            {
+            if (++_ndig > 15) break ;
+            _mant = _mant * 10 + _digi ;
+            }
+        }
+        
+        if (_bptr != _tend && *_bptr == '.' 
+                           && _ndig <= 15)
+        {
+        for (++_bptr; _bptr != _tend; ++_bptr)
+        {
+            unsigned _digi = 
+           (unsigned)(*_bptr - '0') ;
+            
+            if (_digi > +9) break ;
+            
+            _nnum += +1 ;
+            if (_mant != +0 || _digi != +0)
+            {
+            if (++_ndig > 15) break ;
+            _mant = _mant * 10 + _digi ;
+            }
+            _nexp -= +1 ;
+        }
+        }
+        
+    /*------------------------- exponent, as per 1.0E+10 */
+        if (_bptr != _tend && _nnum > 0 && 
+            _ndig <= 15 && 
+           (*_bptr == 'e' || *_bptr == 'E'))
+        {
+            std::int32_t _eval = +0 ;
+            if (scan_indx(
+                _bptr + 1, _tend, _eval) &&
+                _eval > -1000 && _eval < +1000)
+            {
+                _nexp += _eval ;
+                _bptr  = _tend ;
+            }
+        }
+        
+        if (_bptr == _tend && _nnum > +0 &&
+            _ndig <= 15 && 
+            _nexp >= -22 && _nexp <= +22)
+        {
+    /*------------------------- exact: mant. and 10^exp. */
+            _rval = (double)_mant ;
+            
+            if (_nexp < +0)
+                _rval /= _pten[ -_nexp] ;
+            else
+                _rval *= _pten[ +_nexp] ;
+                
+            if (_flip) _rval = -_rval ;
+            
+            return ( true ) ;
+        }
+        
+    /*------------------------- else, via a local buffer */
+        std:: size_t static 
+            constexpr _BMAX = +64 ;
+        
+        std:: size_t _blen = _tend - _head ;
+        
+        if (_blen == +0 || 
+            _blen >= _BMAX) return false ;
+        
+        char _bbuf[_BMAX] ;
+        std::memcpy(_bbuf, _head, _blen) ;
+        _bbuf[_blen] = '\0' ;
+        
+        char *_bend = nullptr ;
+        _rval = std::strtod(_bbuf, &_bend) ;
+        
+        return ( _bend == _bbuf + _blen ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * PRINT-INDX: write int. as chars, in-place.
+    --------------------------------------------------------
+     */
+     
+    __normal_call char * print_indx (
+        char            *_head,
+        std::int32_t     _ival
+        )
+    {
+        std::uint32_t _uval = 
+            (std::uint32_t)_ival ;
+            
+        if (_ival < +0)
+        {
+           *_head++ = '-' ;
+            _uval   = +0u - _uval ;
+        }
+        
+        char _bbuf[ +16] ; 
+        char*_bptr = _bbuf ;
+        do
+        {
+           *_bptr++ = 
+                (char)('0' + _uval % 10) ;
+            _uval  /= +10 ;
+        }
+        while (_uval != +0) ;
+        
+        while (_bptr != _bbuf)
+           *_head++ = *--_bptr ;
+            
+        return (  _head ) ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * PRINT-REAL: write real as chars, in-place.
+    --------------------------------------------------------
+     *
+     * Writes the shortest(-ish) digit string that reads
+     * back as the same double, via the GRISU2 algorithm
+     * of Loitsch, "Printing Floating-Point Numbers Quickly 
+     * and Accurately with Integers", PLDI 2010. Output is 
+     * always round-trip exact, and is the shortest in 
+     * all but a small fraction of cases. No locale, no
+     * allocation. At most 24 chars are written.
+     *
+    --------------------------------------------------------
+     */
+    
+    namespace grisu {
+    
+    class diy_real
+        {
+    /*---------------------- real as F * 2^E, F in uint64 */
+        public  :
+        std::uint64_t       _f ;
+        int                 _e ;
+        
+        public  :
+        __inline_call diy_real (
+            std::uint64_t _fval = +0 ,
+            int           _eval = +0
+            ) : _f(_fval), _e(_eval) {}
+        } ;
+    
+    __inline_call diy_real diy_sub (
+        diy_real const&_xval ,
+        diy_real const&_yval
+        )
+    {
+        return diy_real(
+            _xval._f - _yval._f, _xval._e) ;
+    }
+    
+    __inline_call diy_real diy_mul (
+        diy_real const&_xval ,
+        diy_real const&_yval
+        )
+    {
+    /*---------------------- 64 x 64 -> upper 64, rounded */
+        std::uint64_t static constexpr 
+            _MASK = 0xFFFFFFFFu ;
+    
+        std::uint64_t _xlo = _xval._f & _MASK ;
+        std::uint64_t _xhi = _xval._f >> 32 ;
+        std::uint64_t _ylo = _yval._f & _MASK ;
+        std::uint64_t _yhi = _yval._f >> 32 ;
+        
+        std::uint64_t _p0 = _xlo * _ylo ;
+        std::uint64_t _p1 = _xlo * _yhi ;
+        std::uint64_t _p2 = _xhi * _ylo ;
+        std::uint64_t _p3 = _xhi * _yhi ;
+        
+        std::uint64_t _qq = (_p0 >> 32) + 
+            (_p1 & _MASK) + (_p2 & _MASK) +
+            ((std::uint64_t)1 << 31) ;
+        
+        return diy_real(_p3 + (_p1 >> 32) +
+            (_p2 >> 32) + (_qq >> 32) , 
+                _xval._e + _yval._e + 64) ;
+    }
+    
+    __inline_call diy_real diy_norm (
+        diy_real       _xval
+        )
+    {
+        while ((_xval._f >> 63) == +0)
+        {
+            _xval._f <<= +1 ;
+            _xval._e  -= +1 ;
+        }
+        return _xval ;
+    }
+    
+    class ten_power
+        {
+        public  :
+        std::uint64_t       _f ;
+        int                 _e ;
+        int                 _k ;
+        } ;
+        
+    /*---------------------- 10^K ~= F * 2^E, K = -300:8:324 */
+    __normal_call ten_power const& cached_power (
+        int            _eval
+        )
+    {
+        ten_power static const _pset[ 79] = {
+            { 0xAB70FE17C79AC6CA, -1060, -300 } ,
+            { 0xFF77B1FCBEBCDC4F, -1034, -292 } ,
+            { 0xBE5691EF416BD60C, -1007, -284 } ,
+            { 0x8DD01FAD907FFC3C,  -980, -276 } ,
+            { 0xD3515C2831559A83,  -954, -268 } ,
+            { 0x9D71AC8FADA6C9B5,  -927, -260 } ,
+            { 0xEA9C227723EE8BCB,  -901, -252 } ,
+            { 0xAECC49914078536D,  -874, -244 } ,
+            { 0x823C12795DB6CE57,  -847, -236 } ,
+            { 0xC21094364DFB5637,  -821, -228 } ,
+            { 0x9096EA6F3848984F,  -794, -220 } ,
+            { 0xD77485CB25823AC7,  -768, -212 } ,
+            { 0xA086CFCD97BF97F4,  -741, -204 } ,
+            { 0xEF340A98172AACE5,  -715, -196 } ,
+            { 0xB23867FB2A35B28E,  -688, -188 } ,
+            { 0x84C8D4DFD2C63F3B,  -661, -180 } ,
+            { 0xC5DD44271AD3CDBA,  -635, -172 } ,
+            { 0x936B9FCEBB25C996,  -608, -164 } ,
+            { 0xDBAC6C247D62A584,  -582, -156 } ,
+            { 0xA3AB66580D5FDAF6,  -555, -148 } ,
+            { 0xF3E2F893DEC3F126,  -529, -140 } ,
+            { 0xB5B5ADA8AAFF80B8,  -502, -132 } ,
+            { 0x87625F056C7C4A8B,  -475, -124 } ,
+            { 0xC9BCFF6034C13053,  -449, -116 } ,
+            { 0x964E858C91BA2655,  -422, -108 } ,
+            { 0xDFF9772470297EBD,  -396, -100 } ,
+            { 0xA6DFBD9FB8E5B88F,  -369,  -92 } ,
+            { 0xF8A95FCF88747D94,  -343,  -84 } ,
+            { 0xB94470938FA89BCF,  -316,  -76 } ,
+            { 0x8A08F0F8BF0F156B,  -289,  -68 } ,
+            { 0xCDB02555653131B6,  -263,  -60 } ,
+            { 0x993FE2C6D07B7FAC,  -236,  -52 } ,
+            { 0xE45C10C42A2B3B06,  -210,  -44 } ,
+            { 0xAA242499697392D3,  -183,  -36 } ,
+            { 0xFD87B5F28300CA0E,  -157,  -28 } ,
+            { 0xBCE5086492111AEB,  -130,  -20 } ,
+            { 0x8CBCCC096F5088CC,  -103,  -12 } ,
+            { 0xD1B71758E219652C,   -77,   -4 } ,
+            { 0x9C40000000000000,   -50,    4 } ,
+            { 0xE8D4A51000000000,   -24,   12 } ,
+            { 0xAD78EBC5AC620000,     3,   20 } ,
+            { 0x813F3978F8940984,    30,   28 } ,
+            { 0xC097CE7BC90715B3,    56,   36 } ,
+            { 0x8F7E32CE7BEA5C70,    83,   44 } ,
+            { 0xD5D238A4ABE98068,   109,   52 } ,
+            { 0x9F4F2726179A2245,   136,   60 } ,
+            { 0xED63A231D4C4FB27,   162,   68 } ,
+            { 0xB0DE65388CC8ADA8,   189,   76 } ,
+            { 0x83C7088E1AAB65DB,   216,   84 } ,
+            { 0xC45D1DF942711D9A,   242,   92 } ,
+            { 0x924D692CA61BE758,   269,  100 } ,
+            { 0xDA01EE641A708DEA,   295,  108 } ,
+            { 0xA26DA3999AEF774A,   322,  116 } ,
+            { 0xF209787BB47D6B85,   348,  124 } ,
+            { 0xB454E4A179DD1877,   375,  132 } ,
+            { 0x865B86925B9BC5C2,   402,  140 } ,
+            { 0xC83553C5C8965D3D,   428,  148 } ,
+            { 0x952AB45CFA97A0B3,   455,  156 } ,
+            { 0xDE469FBD99A05FE3,   481,  164 } ,
+            { 0xA59BC234DB398C25,   508,  172 } ,
+            { 0xF6C69A72A3989F5C,   534,  180 } ,
+            { 0xB7DCBF5354E9BECE,   561,  188 } ,
+            { 0x88FCF317F22241E2,   588,  196 } ,
+            { 0xCC20CE9BD35C78A5,   614,  204 } ,
+            { 0x98165AF37B2153DF,   641,  212 } ,
+            { 0xE2A0B5DC971F303A,   667,  220 } ,
+            { 0xA8D9D1535CE3B396,   694,  228 } ,
+            { 0xFB9B7CD9A4A7443C,   720,  236 } ,
+            { 0xBB764C4CA7A44410,   747,  244 } ,
+            { 0x8BAB8EEFB6409C1A,   774,  252 } ,
+            { 0xD01FEF10A657842C,   800,  260 } ,
+            { 0x9B10A4E5E9913129,   827,  268 } ,
+            { 0xE7109BFBA19C0C9D,   853,  276 } ,
+            { 0xAC2820D9623BF429,   880,  284 } ,
+            { 0x80444B5E7AA7CF85,   907,  292 } ,
+            { 0xBF21E44003ACDD2D,   933,  300 } ,
+            { 0x8E679C2F5E44FF8F,   960,  308 } ,
+            { 0xD433179D9C8CB841,   986,  316 } ,
+            { 0x9E19DB92B4E31BA9,  1013,  324 }
+            } ;
+
+    /*---------------------- so that ALPHA <= e+E <= GAMMA */
+        int _fval = -60 - _eval - 1 ;
+        int _kval = (_fval * 78913) / (1 << 18) 
+                  + (_fval > 0 ? 1 : 0) ;
+        
+        return _pset[(300 + _kval + 7) / 8] ;
+    }
+    
+    __normal_call void_type round_last (
+        char          *_dptr ,
+        int            _dlen ,
+        std::uint64_t  _dist ,
+        std::uint64_t  _dval ,
+        std::uint64_t  _rest ,
+        std::uint64_t  _tenk
+        )
+    {
+    /*---------------------- move closer to exact value */
+        while (_rest < _dist && 
+               _dval - _rest >= _tenk &&
+              (_rest + _tenk < _dist || 
+               _dist - _rest > 
+               _rest + _tenk - _dist) )
+        {
+            _dptr[_dlen - 1] -= 1 ;
+            _rest += _tenk ;
+        }
+    }
+    
+    __normal_call void_type make_digits (
+        char          *_dptr ,
+        int           &_dlen ,
+        int           &_dexp ,
+        diy_real const&_wmin ,
+        diy_real const&_wval ,
+        diy_real const&_wmax
+        )
+    {
+    /*---------------------- digits of WMAX, in [WMIN,WMAX] */
+        std::uint64_t _dval = 
+            diy_sub(_wmax, _wmin)._f ;
+        std::uint64_t _dist = 
+            diy_sub(_wmax, _wval)._f ;
+            
+        diy_real _ones(
+           (std::uint64_t)1 << -_wmax._e, _wmax._e) ;
+        
+        std::uint32_t _part = (std::uint32_t)
+            (_wmax._f >> -_ones._e) ;
+        std::uint64_t _frac = 
+            _wmax._f & (_ones._f - 1) ;
+        
+        std::uint32_t _pten =  +1 ;
+        int           _ndig =  +1 ;
+        for ( ; _ndig < 10 && 
+                _part / _pten >= 10; ++_ndig)
+            _pten *= +10 ;
+        
+    /*---------------------- integral part: 1-10 digits */
+        for ( ; _ndig > +0 ; )
+        {
+            _dptr[_dlen++] = 
+                (char)('0' + _part / _pten) ;
+            _part %= _pten ;
+            _ndig -= +1 ;
+            
+            std::uint64_t _rest = 
+           ((std::uint64_t)_part << -_ones._e) 
+                + _frac ;
+            
+            if (_rest <= _dval)
+            {
+                _dexp += _ndig ;
+                
+                round_last(_dptr, _dlen, 
+                    _dist, _dval, _rest, 
+               (std::uint64_t)_pten << -_ones._e) ;
+                    
+                return ;
+            }
+            
+            _pten /= +10 ;
+        }
+        
+    /*---------------------- fractional part, as needed */
+        int _mdig = +0 ;
+        for ( ; ; )
+        {
+            _frac *= +10 ;
+            _dptr[_dlen++] = 
+                (char)('0' + (_frac >> -_ones._e)) ;
+            _frac &= _ones._f - 1 ;
+            _mdig += +1 ;
+            _dval *= +10 ;
+            _dist *= +10 ;
+            
+            if (_frac <= _dval) break ;
+        }
+        
+        _dexp -= _mdig ;
+        
+        round_last(_dptr, _dlen, 
+            _dist, _dval, _frac, _ones._f) ;
+    }
+    
+    __normal_call void_type grisu2 (
+        char          *_dptr ,
+        int           &_dlen ,
+        int           &_dexp ,
+        double         _rval
+        )
+    {
+    /*---------------------- bounds on the real: W-,W,W+ */
+        std::uint64_t _bits ;
+        std::memcpy(&_bits, &_rval, sizeof(double)) ;
+        
+        std::uint64_t static constexpr 
+            _HIDE = (std::uint64_t)1 << 52 ;
+        
+        std::uint64_t _fval = _bits & (_HIDE - 1) ;
+        int           _eval = (int)(_bits >> 52) ;
+        
+        diy_real _vval = _eval == +0 ? 
+            diy_real(_fval, 1 - 1075) : 
+            diy_real(_fval + _HIDE, _eval - 1075) ;
+            
+        bool_type _tail = _fval == +0 && _eval > 1 ;
+        
+        diy_real _vmax = diy_norm(diy_real(
+            2 * _vval._f + 1, _vval._e - 1)) ;
+        
+        diy_real _vmin = _tail ? 
+            diy_real(4 * _vval._f - 1, _vval._e - 2) :
+            diy_real(2 * _vval._f - 1, _vval._e - 1) ;
+        
+        _vmin._f <<= _vmin._e - _vmax._e ;
+        _vmin._e   = _vmax._e ;
+        
+        _vval = diy_norm(_vval) ;
+        
+    /*---------------------- scale by a cached 10^-K */
+        ten_power const&_cpow = 
+            cached_power(_vmax._e) ;
+        
+        diy_real _cten(_cpow._f, _cpow._e) ;
+        
+        diy_real _wval = diy_mul(_vval, _cten) ;
+        diy_real _wmin = diy_mul(_vmin, _cten) ;
+        diy_real _wmax = diy_mul(_vmax, _cten) ;
+        
+        _wmin._f += +1 ;
+        _wmax._f -= +1 ;
+        
+        _dlen = +0 ; _dexp = -_cpow._k ;
+        
+        make_digits(_dptr, _dlen, 
+            _dexp, _wmin, _wval, _wmax) ;
+    }
+    
+    }
+    
+    __normal_call char * print_real (
+        char            *_head,
+        double           _rval
+        )
+    {
+        if (std::signbit(_rval))
+        {
+           *_head++ = '-' ; _rval = -_rval ;
+        }
+        
+        if (_rval == 0.)
+        {
+           *_head++ = '0' ; return _head ;
+        }
+        
+        if (!std::isfinite(_rval))
+        {
+            char const *_sval = 
+                std::isnan(_rval) ? "nan" : "inf" ;
+            std::memcpy(_head, _sval, 3) ;
+            return _head + 3 ;
+        }
+        
+        char _dbuf[ +24] ;
+        int  _dlen, _dexp ;
+        grisu::grisu2(_dbuf, _dlen, _dexp, _rval) ;
+        
+    /*---------------------- value is D.DDD * 10^(N-1) */
+        int _npos = _dlen + _dexp ;
+        
+        if (_dlen <= _npos && _npos <= 16)
+        {
+    /*---------------------- integer, as per "1234500" */
+            std::memcpy(_head, _dbuf, _dlen) ;
+            _head += _dlen ;
+            for ( ; _dlen < _npos; ++_dlen)
+               *_head++ = '0' ;
+        }
+        else
+        if (+0 < _npos && _npos <= 16)
+        {
+    /*---------------------- decimal, as per "123.45" */
+            std::memcpy(_head, _dbuf, _npos) ;
+            _head += _npos ;
+           *_head++ = '.' ;
+            std::memcpy(
+                _head, _dbuf+_npos, _dlen-_npos) ;
+            _head += _dlen - _npos ;
+        }
+        else
+        if (-4 < _npos && _npos <= +0)
+        {
+    /*---------------------- decimal, as per "0.0012345" */
+           *_head++ = '0' ;
+           *_head++ = '.' ;
+            for ( ; _npos < +0; ++_npos)
+               *_head++ = '0' ;
+            std::memcpy(_head, _dbuf, _dlen) ;
+            _head += _dlen ;
+        }
+        else
+        {
+    /*---------------------- scientific, as per "1.2e+45" */
+           *_head++ = _dbuf[0] ;
+            if (_dlen > +1)
+            {
+           *_head++ = '.' ;
+            std::memcpy(
+                _head, _dbuf + 1, _dlen - 1) ;
+            _head += _dlen - 1 ;
+            }
+           *_head++ = 'e' ;
+           
+            int _eval = _npos - 1 ;
+           *_head++ = _eval < 0 ? '-' : '+' ;
+            if (_eval < 0) _eval = -_eval ;
+            
+            if (_eval < 10) *_head++ = '0' ;
+            
+            _head = print_indx(_head, _eval) ;
+        }
+        
+        return (  _head ) ;
+    }
+
     /*
     --------------------------------------------------------
      * FILE-PART: split a file name into path-name-fext.
@@ -219,6 +860,196 @@
         _name = std::string(_pos2, _pos3);
         _fext = std::string(_pos4, _pos5);
     }
+
+    /*
+    --------------------------------------------------------
+     * PACK-BYTES: store value as little-endian bytes.
+    --------------------------------------------------------
+     */
+
+    __inline_call bool_type little_endian (
+        )
+    {
+        std::uint16_t const _word = +1 ;
+        unsigned char _byte ;
+        std::memcpy(&_byte, &_word, +1) ;
+
+        return ( _byte == +1 ) ;
+    }
+     
+    template <
+    typename      data_type
+             >
+    __inline_call void_type pack_bytes (
+        char            *_bptr,
+        data_type const &_data
+        )
+    {
+        std::memcpy(_bptr, 
+            &_data , sizeof(data_type)) ;
+
+        if (!little_endian())
+            std::reverse(_bptr, 
+                _bptr+ sizeof(data_type)) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * LOAD-BYTES: fetch value from little-endian bytes.
+    --------------------------------------------------------
+     */
+     
+    template <
+    typename      data_type
+             >
+    __inline_call data_type load_bytes (
+        char const      *_bptr
+        )
+    {
+        char _bbuf [sizeof(data_type)] ;
+        std::memcpy(_bbuf, 
+            _bptr , sizeof(data_type)) ;
+
+        if (!little_endian())
+            std::reverse(_bbuf, 
+                _bbuf+ sizeof(data_type)) ;
+
+        data_type _data ;
+        std::memcpy(&_data, 
+            _bbuf , sizeof(data_type)) ;
+
+        return  _data ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * FILE-VIEW: read-only view of an entire file.
+    --------------------------------------------------------
+     *
+     * The file is mapped into memory where the platform
+     * supports it (via __use_mmap), and is otherwise read
+     * into a buffer in one pass. Either way, _head points
+     * to _size contiguous bytes until close() is called.
+     *
+    --------------------------------------------------------
+     */
+     
+    class file_view
+    {
+    public  :
+    
+    char const             *_head ;
+    std:: size_t            _size ;
+    
+    bool_type               _fmap ;
+    
+    std::string             _fbuf ;
+    
+    public  :
+    
+    __normal_call file_view (
+        ) : _head(nullptr) ,
+            _size(+0) ,
+            _fmap(false ) {}
+    
+    __normal_call ~file_view (
+        )
+    {
+        this->close () ;
+    }
+    
+    file_view (
+        file_view const&) = delete ;
+    file_view& operator = (
+        file_view const&) = delete ;
+
+    /*------------------------------- open file for read */
+
+    __normal_call bool_type open (
+        std::string const&_fstr
+        )
+    {
+        this->close () ;
+
+#   ifdef  __use_mmap
+        int _fdsc = ::open(
+            _fstr.c_str(), O_RDONLY) ;
+
+        if (_fdsc >= +0)
+        {
+            struct stat _stat ;
+            if (::fstat(_fdsc, &_stat) == +0 &&
+                    _stat.st_size > +0)
+            {
+            void *_addr = ::mmap(nullptr, 
+                (std::size_t)_stat.st_size, 
+                    PROT_READ, MAP_PRIVATE, 
+                        _fdsc, +0) ;
+
+            if (_addr != MAP_FAILED)
+            {
+                ::madvise(_addr, 
+                (std::size_t)_stat.st_size, 
+                    MADV_SEQUENTIAL) ;
+                
+                this->_head = 
+                    (char const *) _addr ;
+                this->_size = 
+                    (std::size_t)_stat.st_size ;
+                this->_fmap = true ;
+            }
+            }
+            
+            ::close(_fdsc) ;
+            
+            if (this->_fmap) return true ;
+        }
+#   endif//__use_mmap
+
+    /*------------------------------- else buffered read */
+        std::ifstream _ffid(_fstr , 
+            std::ifstream::in | 
+            std::ifstream::binary ) ;
+
+        if (!_ffid.is_open()) return false ;
+
+        _ffid.seekg(0, std::ifstream::end) ;
+        std::streamoff _fend = _ffid.tellg();
+        _ffid.seekg(0, std::ifstream::beg) ;
+
+        if (_fend > +0)
+        {
+            this->_fbuf.resize(
+                (std::size_t) _fend) ;
+            _ffid.read(&this->_fbuf[0], _fend) ;
+        }
+
+        this->_head = this->_fbuf.data() ;
+        this->_size = this->_fbuf.size() ;
+
+        return  true ;
+    }
+
+    /*------------------------------- release file bytes */
+
+    __normal_call void_type close (
+        )
+    {
+#   ifdef  __use_mmap
+        if (this->_fmap)
+            ::munmap((void *)this->_head,
+                this->_size) ;
+#   endif//__use_mmap
+
+        this->_fbuf.clear() ;
+        this->_fbuf.shrink_to_fit() ;
+
+        this->_head = nullptr ;
+        this->_size = +0 ;
+        this->_fmap = false ;
+    }
+    
+    } ;
  
     
 #   endif//__LIBPARSE__
@@ -81,6 +81,13 @@
         hint_type &_hint
         )  {}
         
+    __normal_call void_type eval (      // batched
+        iptr_type        _npts ,
+        real_type const *_ppos ,
+        real_type       *_hval ,
+        hint_type       *_hint
+        )  {}
+        
     __inline_call real_type eval (
         real_type *_ppos ,
         hint_type&&_hint = null_hint ()
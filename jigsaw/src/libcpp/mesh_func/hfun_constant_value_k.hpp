@@ -89,6 +89,30 @@
         return  this-> _hval  ;
     }
     
+    __inline_call void_type eval (
+        iptr_type        _npts ,
+        real_type const *_ppos ,
+        real_type       *_hval ,
+        hint_type       *_hint
+        )
+    {   
+        __unreferenced(_ppos) ;
+        __unreferenced(_hint) ;
+    
+        std::fill(_hval, 
+            _hval + _npts, this->_hval) ;
+    }
+    
+    
+    /*--------------------------- nothing to limit: h = c */
+    
+    __inline_call void_type clip (
+        real_type _dhdx
+        )
+    {   
+        __unreferenced(_dhdx) ;
+    }
+
     } ;
     
     
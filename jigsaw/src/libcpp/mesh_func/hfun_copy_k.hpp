@@ -0,0 +1,90 @@
+
+    /*
+    --------------------------------------------------------
+     * HFUN-COPY-K: eval. H(x) on a private copy of HINT.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the 
+     * condition that the copyright notices (including this 
+     * entire header) are not removed, and no compensation 
+     * is received through use of the software.  Private, 
+     * research, and institutional use is free.  You may 
+     * distribute modified versions of this code UNDER THE 
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE 
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE 
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE 
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR 
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution 
+     * of this code as part of a commercial system is 
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE 
+     * AUTHOR.  (If you are not directly supplying this 
+     * code to a customer, and you are instead telling them 
+     * how they can obtain it for free, then you are not 
+     * required to make any arrangement with me.) 
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The 
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any 
+     * way whatsoever.  This code is provided "as-is" to be 
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * HFUN-COPY wraps an H(x) type for calls made in ||.
+     * The node hints are warmed serially first, and are
+     * then only read by each thread, never written.
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __HFUN_COPY_K__
+#   define __HFUN_COPY_K__
+
+    namespace mesh {
+
+    template <
+    typename H
+             >
+    class hfun_copy_kd
+    {
+    public  :
+
+    /*-------------------- eval. H(x) on a "private" hint */
+
+    typedef H                           hfun_type ;
+
+    typedef typename
+            hfun_type::real_type        real_type ;
+    typedef typename
+            hfun_type::hint_type        hint_type ;
+
+    hfun_type                          *_hfun ;
+
+    public  :
+
+    __inline_call hfun_copy_kd (
+        hfun_type *_hsrc
+        ) : _hfun(_hsrc) {}
+
+    __inline_call real_type eval (
+        real_type *_ppos ,
+        hint_type const&_hint
+        ) const
+    {
+        hint_type _hnow = _hint ;
+
+        return _hfun->eval(_ppos, _hnow) ;
+    }
+
+    } ;
+
+
+    }
+
+#   endif   //__HFUN_COPY_K__
+
+
+
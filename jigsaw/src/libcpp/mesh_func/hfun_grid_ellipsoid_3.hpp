@@ -84,6 +84,24 @@
         
     bool_type                      _xvar;
     bool_type                      _yvar;
+    
+    containers::array <
+        iptr_type, allocator>      _xbin;
+    containers::array <
+        iptr_type, allocator>      _ybin;
+    
+    real_type                      _xdel;
+    real_type                      _ydel;
+    
+    real_type                      _xbkt;
+    real_type                      _ybkt;
+    
+    real_type                      _radA =  // 0 if
+                            (real_type) +0. ;// unset
+    real_type                      _radB = 
+                            (real_type) +0. ;
+    real_type                      _radC = 
+                            (real_type) +0. ;
                
     public  :
 
@@ -165,52 +183,126 @@
                 _yvar =  true ; break ;
             }
         }
-     
+        
+        this->_xdel = _xbar ;
+        this->_ydel = _ybar ;
+        
+    /*---------------------------- bucket non-uniform axes */
+        if (this->_xvar)
+        make_bins(this->_xpos, 
+            this->_xbin, this->_xbkt) ;
+        
+        if (this->_yvar)
+        make_bins(this->_ypos, 
+            this->_ybin, this->_ybkt) ;
     }
-
+    
     /*
     --------------------------------------------------------
-     * EVAL: eval. size-fun. value.
+     * MAKE-BINS: uniform buckets over a non-uniform axis.
+    --------------------------------------------------------
+     *
+     * Buckets are spaced uniformly over [x(1), x(N)], with
+     * each storing the last node x(j) <= its lower bound,
+     * so that FIND-CELL starts within a step or two of the
+     * enclosing interval, rather than binary-searching it.
+     *
     --------------------------------------------------------
      */
-    
-    __normal_call real_type eval (
-        real_type *_ppos ,
-        hint_type &_hint
+     
+    __normal_call void_type make_bins (
+        containers::array <
+        real_type, allocator>&_xset ,
+        containers::array <
+        iptr_type, allocator>&_xbin ,
+        real_type            &_xbkt
         )
-    {   
-        real_type static const FT = 
-            std::pow (
-        +std::numeric_limits <real_type>
-            ::epsilon(),(real_type)+.8);
-    
-        real_type _hval = 
-            +std::numeric_limits
-                <real_type>::infinity();
+    {
+        iptr_type _nbin = 
+       (iptr_type)_xset.count() ;
+       
+        real_type _xmin = *_xset.head() ;
+        real_type _xmax = *_xset.tail() ;
+        
+        _xbkt = (_xmax - _xmin) / _nbin ;
+        
+        _xbin.set_count(_nbin) ;
+        
+        iptr_type _jpos = +0 ;
+        for (auto _ibin = +0; 
+                _ibin < _nbin; ++_ibin)
+        {
+            real_type _xval = 
+                _xmin + _ibin * _xbkt ;
+        
+            for ( ; _jpos + 1 < _nbin && 
+                _xset[_jpos + 1] <= _xval; )
+                _jpos += +1 ;
+                
+            _xbin[_ibin] = _jpos ;
+        }
+    }
     
-        __unreferenced(_hint) ;
+    /*
+    --------------------------------------------------------
+     * FIND-CELL: interval j such that x(j) <= x < x(j+1).
+    --------------------------------------------------------
+     */
+     
+    __inline_call iptr_type find_cell (
+        containers::array <
+        real_type, allocator>&_xset ,
+        containers::array <
+        iptr_type, allocator>&_xbin ,
+        real_type             _xbkt ,
+        real_type             _xval ,
+        iptr_type             _hint
+        )
+    {
+        iptr_type _nset = 
+       (iptr_type)_xset.count() ;
     
-        if (this->_xpos.count() == +0)
-            return _hval ;
+        if (_hint >= +0 && _hint < _nset && 
+            _xset[_hint] <= _xval && 
+           (_hint + 1 == _nset ||
+            _xset[_hint + 1] > _xval) )
+    /*---------------------------- hint is still valid */
+            return _hint ;
+        
+    /*---------------------------- else, jump via bucket */
+        iptr_type _ibin = (iptr_type)
+       ((_xval - *_xset.head()) / _xbkt) ;
+        
+        if (_ibin < +0) _ibin = +0 ;
+        if (_ibin >= _nset)
+            _ibin = _nset - 1 ;
+        
+        iptr_type _jpos = _xbin[_ibin] ;
+        
+    /*---------------------------- walk to x(j) <= x, etc */
+        for ( ; _jpos > +0 && 
+            _xset[_jpos] > _xval; )
+            _jpos -= +1 ;
             
-        if (this->_ypos.count() == +0)
-            return _hval ;
+        for ( ; _jpos + 1 < _nset && 
+            _xset[_jpos + 1] <= _xval; )
+            _jpos += +1 ;
     
-    /*---------------------------- compute xyz to lat-lon */
-        real_type _radius = std::sqrt (
-            _ppos[0]*_ppos[0] + 
-            _ppos[1]*_ppos[1] + 
-            _ppos[2]*_ppos[2] ) ; 
-         
-        if (_radius < FT)
-        _radius = _radius + FT;
-         
-        real_type _alat = 
-        std::asin (_ppos[2]/ _radius ) ;
-        
-        real_type _alon = 
-        std::atan2(_ppos[1], _ppos[0]) ;
+        return _jpos ;
+    }
 
+    /*
+    --------------------------------------------------------
+     * EVAL-GRID: eval. size-fun. at lon.-lat. position.
+    --------------------------------------------------------
+     */
+    
+    __normal_call real_type eval_grid (
+        real_type  _alon ,
+        real_type  _alat ,
+        hint_type &_hint
+        )
+    {
         real_type static const PI =
        (real_type)std::atan(+1.0) * 4. ;
        
@@ -237,57 +329,45 @@
         if (_alat > *this->_ypos.tail())
             _alat = *this->_ypos.tail();
         
-    /*---------------------------- find enclosing x-range */
+    /*---------------------------- unpack cell from hint */
+        iptr_type _ynum = 
+       (iptr_type)this->_ypos.count() ;
+        
         iptr_type _ipos = (iptr_type) -1 ;
         iptr_type _jpos = (iptr_type) -1 ;
+        
+        if (_hint >= +0)
+        {
+            _ipos = _hint % _ynum ;
+            _jpos = _hint / _ynum ;
+        }
            
+    /*---------------------------- find enclosing x-range */
         if (this->_xvar == true)
         {
-            auto _joff = 
-            algorithms::upper_bound (
-                this->_xpos.head(), 
-                this->_xpos.tend(), 
-            _alon,std::less<real_type>() ) ;
-           
-            _jpos = (iptr_type) (
-            _joff - this->_xpos.head()- 1) ;
+            _jpos = find_cell(this->_xpos, 
+                this->_xbin, this->_xbkt, 
+                    _alon, _jpos) ;
         }
         else
         {
-            real_type _xmin, _xmax, _xdel;
-            _xmin = *this->_xpos.head();
-            _xmax = *this->_xpos.tail();
-            
-            _xdel = (_xmax - _xmin) /
-                (this->_xpos.count () - 1) ;
-            
             _jpos = (iptr_type)
-                ((_alon-_xmin)/_xdel) ;
+               ((_alon - *this->_xpos.head()) 
+                    / this->_xdel) ;
         }
         
     /*---------------------------- find enclosing y-range */
         if (this->_yvar == true)
         {
-            auto _ioff = 
-            algorithms::upper_bound (
-                this->_ypos.head(), 
-                this->_ypos.tend(), 
-            _alat,std::less<real_type>() ) ;
-           
-            _ipos = (iptr_type) (
-            _ioff - this->_ypos.head()- 1) ;
+            _ipos = find_cell(this->_ypos, 
+                this->_ybin, this->_ybkt, 
+                    _alat, _ipos) ;
         }
         else
         {
-            real_type _ymin, _ymax, _ydel;
-            _ymin = *this->_ypos.head();
-            _ymax = *this->_ypos.tail();
-            
-            _ydel = (_ymax - _ymin) /
-                (this->_ypos.count () - 1) ;
-            
             _ipos = (iptr_type)
-                ((_alat-_ymin)/_ydel) ;
+               ((_alat - *this->_ypos.head()) 
+                    / this->_ydel) ;
         }
         
         if (_ipos == 
@@ -333,6 +413,9 @@
         iptr_type _kk22 ;
         indx_from_subs(
             _ipos + 1, _jpos + 1, _kk22) ;
+            
+    /*---------------------------- cache cell for next */
+        _hint = _kk11 ;
         
         real_type _hbar = 
           ( _aa11*this->_hmat[_kk11]
@@ -343,7 +426,325 @@
 
         return (  _hbar ) ; 
     }
+
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. value.
+    --------------------------------------------------------
+     */
+    
+    __normal_call real_type eval (
+        real_type *_ppos ,
+        hint_type &_hint
+        )
+    {   
+        real_type static const FT = 
+            std::pow (
+        +std::numeric_limits <real_type>
+            ::epsilon(),(real_type)+.8);
+    
+        real_type _hval = 
+            +std::numeric_limits
+                <real_type>::infinity();
+    
+        if (this->_xpos.count() == +0)
+            return _hval ;
+            
+        if (this->_ypos.count() == +0)
+            return _hval ;
+    
+    /*---------------------------- compute xyz to lat-lon */
+        real_type _radius = std::sqrt (
+            _ppos[0]*_ppos[0] + 
+            _ppos[1]*_ppos[1] + 
+            _ppos[2]*_ppos[2] ) ; 
+         
+        if (_radius < FT)
+        _radius = _radius + FT;
+         
+        real_type _alat = 
+        std::asin (_ppos[2]/ _radius ) ;
+        
+        real_type _alon = 
+        std::atan2(_ppos[1], _ppos[0]) ;
+
+        return eval_grid(_alon, _alat, _hint) ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. over a set of points.
+    --------------------------------------------------------
+     *
+     * XYZ is a packed (x,y,z) array of NPTS points, with
+     * values returned in HVAL. HINT is optional, and is 
+     * both read and updated per point if non-null. The
+     * xyz to lat-lon transform is done in blocks, as a
+     * flat loop for the compiler to vectorise.
+     *
+    --------------------------------------------------------
+     */
+    
+    __normal_call void_type eval (
+        iptr_type        _npts ,
+        real_type const *_ppos ,
+        real_type       *_hval ,
+        hint_type       *_hint
+        )
+    {   
+        real_type static const FT = 
+            std::pow (
+        +std::numeric_limits <real_type>
+            ::epsilon(),(real_type)+.8);
+            
+        iptr_type static 
+            constexpr _BLCK = +64 ;
+        
+        if (this->_xpos.count() == +0 ||
+            this->_ypos.count() == +0 )
+        {
+            for (auto _ipos = +0; 
+                _ipos < _npts; ++_ipos)
+            _hval[_ipos] = 
+                +std::numeric_limits
+                    <real_type>::infinity();
+                    
+            return ;
+        }
+        
+        real_type _alon[_BLCK] ;
+        real_type _alat[_BLCK] ;
+        
+        for (auto _ioff = +0; 
+            _ioff < _npts; _ioff += _BLCK)
+        {
+            iptr_type _iend = 
+                std::min(_npts, _ioff + _BLCK) ;
+            
+            iptr_type _nblk = _iend - _ioff ;
+            
+            real_type const *_pblk = 
+                _ppos + _ioff * 3 ;
+        
+    /*---------------------------- xyz to lat-lon, as SoA */
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            {
+            real_type _xval = _pblk[_ipos*3+0] ;
+            real_type _yval = _pblk[_ipos*3+1] ;
+            real_type _zval = _pblk[_ipos*3+2] ;
+            
+            real_type _radius = std::sqrt (
+                _xval * _xval + 
+                _yval * _yval + 
+                _zval * _zval ) ;
+                
+            if (_radius < FT)
+            _radius = _radius + FT;
+            
+            _alat[_ipos] = 
+                std::asin (_zval / _radius) ;
+            _alon[_ipos] = 
+                std::atan2(_yval , _xval) ;
+            }
+            
+    /*---------------------------- lookup + interpolate */
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            {
+            hint_type _hnow = _hint != nullptr ? 
+                _hint[_ioff + _ipos] :
+                    this->null_hint () ;
+                    
+            _hval[_ioff + _ipos] = eval_grid (
+                _alon[_ipos], 
+                _alat[_ipos], _hnow) ;
+                
+            if (_hint != nullptr)
+                _hint[_ioff + _ipos] = _hnow ;
+            }
+        }
+    }
      
+    
+    /*
+    --------------------------------------------------------
+     * CLIP: limit |dh/dx| over the grid.
+    --------------------------------------------------------
+     */
+    
+    class limit_grid
+        {
+    /*------------------------ grid "adaptor" for HJ-MESH */
+        public  :
+        typedef R                   real_type ;
+        typedef I                   iptr_type ;
+        typedef A                   allocator ;
+        
+        hfun_grid_ellipsoid_3d     *_hfun ;
+        
+        iptr_type                   _xnum ;
+        iptr_type                   _ynum ;
+        
+        bool_type                   _wrap ;
+        
+        containers::array <
+            real_type, allocator>  _xcos ;
+        containers::array <
+            real_type, allocator>  _xsin ;
+        containers::array <
+            real_type, allocator>  _ycos ;
+        containers::array <
+            real_type, allocator>  _ysin ;
+        
+        public  :
+        __inline_call iptr_type node_count (
+            ) const
+        {   return _xnum * _ynum ;
+        }
+        
+        __inline_call real_type&node_hval (
+            iptr_type _inod
+            )
+        {   return _hfun->_hmat[_inod] ;
+        }
+        
+        __inline_call void_type node_ppos (
+            iptr_type _inod ,
+            real_type*_ppos
+            ) const
+        {
+            iptr_type _ipos = _inod % _ynum ;
+            iptr_type _jpos = _inod / _ynum ;
+        
+    /*------------------------ lon.-lat. to xyz on R^3 */
+            _ppos[0] = _hfun->_radA * 
+                _xcos[_jpos] * _ycos[_ipos] ;
+            _ppos[1] = _hfun->_radB * 
+                _xsin[_jpos] * _ycos[_ipos] ;
+            _ppos[2] = _hfun->_radC * 
+                _ysin[_ipos] ;
+        }
+        
+        template <
+        typename      func_type
+                 >
+        __inline_call void_type node_adjs (
+            iptr_type _inod ,
+            func_type&_func
+            ) const
+        {
+            iptr_type _ipos = _inod % _ynum ;
+            iptr_type _jpos = _inod / _ynum ;
+        
+    /*------------------------ both splits of adj. quad's */
+            for (auto _ioff = -1; 
+                      _ioff <= +1; _ioff += 2)
+            for (auto _joff = -1; 
+                      _joff <= +1; _joff += 2)
+            {
+                iptr_type _inew = _ipos+_ioff ;
+                iptr_type _jnew = _jpos+_joff ;
+            
+                if (_inew < +0 || 
+                    _inew >= _ynum) continue ;
+                
+                if (_wrap)
+                {
+    /*------------------------ periodic in the lon.-dir. */
+                if (_jnew < +0) 
+                    _jnew += _xnum ;
+                if (_jnew >= _xnum) 
+                    _jnew -= _xnum ;
+                }
+                else
+                {
+                if (_jnew < +0 || 
+                    _jnew >= _xnum) continue ;
+                }
+                
+                iptr_type _bnod = 
+                    _jpos * _ynum + _inew ;
+                iptr_type _cnod = 
+                    _jnew * _ynum + _inew ;
+                iptr_type _dnod = 
+                    _jnew * _ynum + _ipos ;
+                
+                _func(_bnod, _cnod) ;
+                _func(_cnod, _dnod) ;
+                _func(_bnod, _dnod) ;
+            }
+        }
+        } ;
+    
+    __normal_call void_type clip (
+        real_type _dhdx
+        )
+    {
+        real_type static const PI_2 = 
+       (real_type)std::atan(+1.0) * 8. ;
+    
+        limit_grid _ffun ;
+        _ffun._hfun = this ;
+        _ffun._xnum = 
+       (iptr_type)this->_xpos.count() ;
+        _ffun._ynum = 
+       (iptr_type)this->_ypos.count() ;
+        
+        if (_ffun.node_count() != 
+       (iptr_type)this->_hmat.count())
+            return ;
+        
+        if (_ffun.node_count() == +0)
+            return ;
+
+    /*------------------------ cache sin, cos of lon.-lat. */
+        for (auto _iter  = 
+            this->_xpos.head() ;
+                  _iter != 
+            this->_xpos.tend() ;
+                ++_iter  )
+        {
+            _ffun._xcos.
+                push_tail(std::cos(*_iter)) ;
+            _ffun._xsin.
+                push_tail(std::sin(*_iter)) ;
+        }
+        
+        for (auto _iter  = 
+            this->_ypos.head() ;
+                  _iter != 
+            this->_ypos.tend() ;
+                ++_iter  )
+        {
+            _ffun._ycos.
+                push_tail(std::cos(*_iter)) ;
+            _ffun._ysin.
+                push_tail(std::sin(*_iter)) ;
+        }
+        
+    /*------------------------ "wrap" if grid spans 2*pi */
+        _ffun._wrap = false ;
+        
+        if (_ffun._xnum > +2)
+        {
+        real_type _xdel = 
+            *(this->_xpos.head() + 1) -
+            *(this->_xpos.head() + 0) +
+            *(this->_xpos.tail() - 0) -
+            *(this->_xpos.tail() - 1) ;
+        
+        real_type _xgap = PI_2 - (
+            *this->_xpos.tail() - 
+            *this->_xpos.head() ) ;
+         
+        _ffun._wrap = _xgap <= _xdel ;
+        }
+        
+        hj_mesh_2<limit_grid>::
+            limit_mesh(_ffun, _dhdx) ;
+    }
+
     } ;
      
      
@@ -169,102 +169,103 @@
     
     /*
     --------------------------------------------------------
-     * EVAL: eval. size-fun. value.
+     * FIND-INDX: interval j such that x(j) <= x < x(j+1).
     --------------------------------------------------------
      */
     
-    __inline_call real_type eval (
-        real_type *_ppos,
-        hint_type &_hint
+    __inline_call iptr_type find_indx (
+        containers::array <
+        real_type, allocator>&_xset ,
+        bool_type             _xvar ,
+        real_type             _xval
         )
     {
-        real_type _hval = 
-    +std::numeric_limits<real_type>::infinity();
-    
-        __unreferenced (_hint) ;
-    
-        if (this->_xpos.count() == +0)
-            return _hval ;
-        
-        real_type _xpos = _ppos[0] ;
-        
-        if (_xpos < *this->_xpos.head() )
-            _xpos = *this->_xpos.head() ;
-        if (_xpos > *this->_xpos.tail() )
-            _xpos = *this->_xpos.tail() ;
-        
-        if (this->_ypos.count() == +0)
-            return _hval ;
-            
-        real_type _ypos = _ppos[1] ;
-            
-        if (_ypos < *this->_ypos.head() )
-            _ypos = *this->_ypos.head() ;
-        if (_ypos > *this->_ypos.tail() )
-            _ypos = *this->_ypos.tail() ;
-    
-    /*---------------------------- find enclosing x-range */
-        iptr_type _ipos = (iptr_type)-1 ;
         iptr_type _jpos = (iptr_type)-1 ;
-           
-        if (this->_xvar == true)
+    
+        if (_xvar == true)
         {
             auto _joff = 
             algorithms::upper_bound (
-                this->_xpos.head(), 
-                this->_xpos.tend(), 
-            _xpos,std::less<real_type>());
+                _xset.head(), 
+                _xset.tend(), 
+            _xval,std::less<real_type>());
            
             _jpos = (iptr_type) (
-            _joff-this->_xpos.head() - 1);
+            _joff - _xset.head() - 1);
         }
         else
         {
             real_type _xmin, _xmax, _xdel;
-            _xmin = *this->_xpos.head();
-            _xmax = *this->_xpos.tail();
+            _xmin = *_xset.head();
+            _xmax = *_xset.tail();
             
             _xdel = (_xmax - _xmin) /
-                (this->_xpos.count() - 1);
+                (_xset.count() - 1);
             
             _jpos = (iptr_type)
-              ( (_xpos - _xmin) / _xdel );
+              ( (_xval - _xmin) / _xdel );
         }
         
-    /*---------------------------- find enclosing y-range */
-        if (this->_yvar == true)
+        if (_jpos == 
+       (iptr_type)_xset.count() - 1)
+            _jpos = _jpos - 1 ;
+            
+        return _jpos ;
+    }
+    
+    __normal_call void_type find_indx (
+        containers::array <
+        real_type, allocator>&_xset ,
+        bool_type             _xvar ,
+        iptr_type             _nblk ,
+        real_type const      *_xval ,
+        iptr_type            *_jval
+        )
+    {
+        if (_xvar == true)
         {
-            auto _ioff = 
-            algorithms::upper_bound (
-                this->_ypos.head(), 
-                this->_ypos.tend(), 
-            _ypos,std::less<real_type>());
-           
-            _ipos = (iptr_type) (
-            _ioff-this->_ypos.head() - 1);
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            _jval[_ipos] = find_indx(
+                _xset, _xvar, _xval[_ipos]) ;
         }
         else
         {
-            real_type _ymin, _ymax, _ydel;
-            _ymin = *this->_ypos.head();
-            _ymax = *this->_ypos.tail();
+    /*---------------------------- flat loop, as per SIMD */
+            real_type _xmin, _xmax, _xdel;
+            _xmin = *_xset.head();
+            _xmax = *_xset.tail();
             
-            _ydel = (_ymax - _ymin) /
-                (this->_ypos.count() - 1);
+            _xdel = (_xmax - _xmin) /
+                (_xset.count() - 1);
+                
+            iptr_type _xend = 
+           (iptr_type)_xset.count() - 1 ;
             
-            _ipos = (iptr_type)
-              ( (_ypos - _ymin) / _ydel );
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            {
+            _jval[_ipos] = (iptr_type)
+                ((_xval[_ipos] - _xmin) / _xdel) ;
+            _jval[_ipos] -= 
+                _jval[_ipos] == _xend ? 1 : 0 ;
+            }
         }
-        
-        if (_ipos == 
-       (iptr_type)this->_ypos.count() - 1)
-            _ipos = _ipos - 1 ;
-        
-        if (_jpos == 
-       (iptr_type)this->_xpos.count() - 1)
-            _jpos = _jpos - 1 ;
-        
-    /*---------------------------- a linear interpolation */
+    }
+    
+    /*
+    --------------------------------------------------------
+     * EVAL-CELL: interpolate within the (i,j)-th cell.
+    --------------------------------------------------------
+     */
+    
+    __inline_call real_type eval_cell (
+        real_type  _xpos,
+        real_type  _ypos,
+        iptr_type  _ipos,
+        iptr_type  _jpos
+        )
+    {
         real_type _xx11 = 
             this->_xpos[_jpos + 0] ;
         real_type _xx22 = 
@@ -305,6 +306,238 @@
         return (  _hbar ) ;    
     }
     
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. value.
+    --------------------------------------------------------
+     */
+    
+    __inline_call real_type eval (
+        real_type *_ppos,
+        hint_type &_hint
+        )
+    {
+        real_type _hval = 
+    +std::numeric_limits<real_type>::infinity();
+    
+        __unreferenced (_hint) ;
+    
+        if (this->_xpos.count() == +0)
+            return _hval ;
+        
+        real_type _xpos = _ppos[0] ;
+        
+        if (_xpos < *this->_xpos.head() )
+            _xpos = *this->_xpos.head() ;
+        if (_xpos > *this->_xpos.tail() )
+            _xpos = *this->_xpos.tail() ;
+        
+        if (this->_ypos.count() == +0)
+            return _hval ;
+            
+        real_type _ypos = _ppos[1] ;
+            
+        if (_ypos < *this->_ypos.head() )
+            _ypos = *this->_ypos.head() ;
+        if (_ypos > *this->_ypos.tail() )
+            _ypos = *this->_ypos.tail() ;
+    
+    /*---------------------------- find enclosing xy-cell */
+        iptr_type _jpos = find_indx(
+            this->_xpos, this->_xvar, _xpos) ;
+        iptr_type _ipos = find_indx(
+            this->_ypos, this->_yvar, _ypos) ;
+        
+    /*---------------------------- a linear interpolation */
+        return eval_cell(
+            _xpos, _ypos, _ipos, _jpos) ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. over a set of points.
+    --------------------------------------------------------
+     *
+     * PPOS is a packed (x,y) array of NPTS points, with
+     * values returned in HVAL. Points are processed in
+     * blocks, with the clamping and uniform-axis indexing
+     * done as flat SoA loops for the compiler to vectorise.
+     *
+    --------------------------------------------------------
+     */
+    
+    __normal_call void_type eval (
+        iptr_type        _npts ,
+        real_type const *_ppos ,
+        real_type       *_hval ,
+        hint_type       *_hint
+        )
+    {
+        iptr_type static 
+            constexpr _BLCK = +64 ;
+            
+        __unreferenced (_hint) ;
+    
+        if (this->_xpos.count() == +0 ||
+            this->_ypos.count() == +0 )
+        {
+            for (auto _ipos = +0; 
+                _ipos < _npts; ++_ipos)
+            _hval[_ipos] = 
+                +std::numeric_limits
+                    <real_type>::infinity();
+                    
+            return ;
+        }
+        
+        real_type _xmin = *this->_xpos.head() ;
+        real_type _xmax = *this->_xpos.tail() ;
+        real_type _ymin = *this->_ypos.head() ;
+        real_type _ymax = *this->_ypos.tail() ;
+        
+        real_type _xval[_BLCK] ;
+        real_type _yval[_BLCK] ;
+        iptr_type _jval[_BLCK] ;
+        iptr_type _ival[_BLCK] ;
+        
+        for (auto _ioff = +0; 
+            _ioff < _npts; _ioff += _BLCK)
+        {
+            iptr_type _nblk = std::min(
+                _npts - _ioff, _BLCK) ;
+            
+            real_type const *_pblk = 
+                _ppos + _ioff * 2 ;
+        
+    /*---------------------------- clamp to grid, as SoA */
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            {
+            _xval[_ipos] = std::min(std::max(
+                _pblk[_ipos*2+0], _xmin), _xmax) ;
+            _yval[_ipos] = std::min(std::max(
+                _pblk[_ipos*2+1], _ymin), _ymax) ;
+            }
+            
+    /*---------------------------- find enclosing xy-cell */
+            find_indx(this->_xpos, this->_xvar, 
+                _nblk, _xval, _jval) ;
+            find_indx(this->_ypos, this->_yvar, 
+                _nblk, _yval, _ival) ;
+            
+    /*---------------------------- a linear interpolation */
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            {
+            _hval[_ioff + _ipos] = eval_cell (
+                _xval[_ipos], _yval[_ipos], 
+                _ival[_ipos], _jval[_ipos]) ;
+            }
+        }
+    }
+    
+    
+    /*
+    --------------------------------------------------------
+     * CLIP: limit |dh/dx| over the grid.
+    --------------------------------------------------------
+     */
+    
+    class limit_grid
+        {
+    /*------------------------ grid "adaptor" for HJ-MESH */
+        public  :
+        typedef R                   real_type ;
+        typedef I                   iptr_type ;
+        typedef A                   allocator ;
+        
+        hfun_grid_euclidean_2d     *_hfun ;
+        
+        iptr_type                   _xnum ;
+        iptr_type                   _ynum ;
+        
+        public  :
+        __inline_call iptr_type node_count (
+            ) const
+        {   return _xnum * _ynum ;
+        }
+        
+        __inline_call real_type&node_hval (
+            iptr_type _inod
+            )
+        {   return _hfun->_hmat[_inod] ;
+        }
+        
+        __inline_call void_type node_ppos (
+            iptr_type _inod ,
+            real_type*_ppos
+            ) const
+        {
+            _ppos[0] = _hfun->
+                _xpos[_inod / _ynum] ;
+            _ppos[1] = _hfun->
+                _ypos[_inod % _ynum] ;
+            _ppos[2] = (real_type) +0. ;
+        }
+        
+        template <
+        typename      func_type
+                 >
+        __inline_call void_type node_adjs (
+            iptr_type _inod ,
+            func_type&_func
+            ) const
+        {
+            iptr_type _ipos = _inod % _ynum ;
+            iptr_type _jpos = _inod / _ynum ;
+        
+    /*------------------------ both splits of adj. quad's */
+            for (auto _ioff = -1; 
+                      _ioff <= +1; _ioff += 2)
+            for (auto _joff = -1; 
+                      _joff <= +1; _joff += 2)
+            {
+                iptr_type _inew = _ipos+_ioff ;
+                iptr_type _jnew = _jpos+_joff ;
+            
+                if (_inew < +0 || 
+                    _inew >= _ynum) continue ;
+                if (_jnew < +0 || 
+                    _jnew >= _xnum) continue ;
+                
+                iptr_type _bnod = 
+                    _jpos * _ynum + _inew ;
+                iptr_type _cnod = 
+                    _jnew * _ynum + _inew ;
+                iptr_type _dnod = 
+                    _jnew * _ynum + _ipos ;
+                
+                _func(_bnod, _cnod) ;
+                _func(_cnod, _dnod) ;
+                _func(_bnod, _dnod) ;
+            }
+        }
+        } ;
+    
+    __normal_call void_type clip (
+        real_type _dhdx
+        )
+    {
+        limit_grid _ffun ;
+        _ffun._hfun = this ;
+        _ffun._xnum = 
+       (iptr_type)this->_xpos.count() ;
+        _ffun._ynum = 
+       (iptr_type)this->_ypos.count() ;
+        
+        if (_ffun.node_count() != 
+       (iptr_type)this->_hmat.count())
+            return ;
+        
+        hj_mesh_2<limit_grid>::
+            limit_mesh(_ffun, _dhdx) ;
+    }
+
     } ;
     
     
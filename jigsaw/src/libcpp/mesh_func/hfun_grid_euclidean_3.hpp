@@ -203,142 +203,105 @@
     
     /*
     --------------------------------------------------------
-     * EVAL: eval. size-fun. value.
+     * FIND-INDX: interval j such that x(j) <= x < x(j+1).
     --------------------------------------------------------
      */
     
-    __inline_call real_type eval (
-        real_type *_ppos,
-        hint_type &_hint
+    __inline_call iptr_type find_indx (
+        containers::array <
+        real_type, allocator>&_xset ,
+        bool_type             _xvar ,
+        real_type             _xval
         )
     {
-        real_type _hval = 
-    +std::numeric_limits<real_type>::infinity();
-    
-        __unreferenced (_hint) ;
-    
-        if (this->_xpos.count() == +0)
-            return _hval ;
-        
-        real_type _xpos = _ppos[0] ;
-        
-        if (_xpos < *this->_xpos.head() )
-            _xpos = *this->_xpos.head() ;
-        if (_xpos > *this->_xpos.tail() )
-            _xpos = *this->_xpos.tail() ;
-        
-        if (this->_ypos.count() == +0)
-            return _hval ;
-            
-        real_type _ypos = _ppos[1] ;
-            
-        if (_ypos < *this->_ypos.head() )
-            _ypos = *this->_ypos.head() ;
-        if (_ypos > *this->_ypos.tail() )
-            _ypos = *this->_ypos.tail() ;
-            
-        if (this->_zpos.count() == +0)
-            return _hval ;
-            
-        real_type _zpos = _ppos[2] ;
-            
-        if (_zpos < *this->_zpos.head() )
-            _zpos = *this->_zpos.head() ;
-        if (_zpos > *this->_zpos.tail() )
-            _zpos = *this->_zpos.tail() ;
-            
-    /*---------------------------- find enclosing x-range */
-        iptr_type _ipos = (iptr_type)-1 ;
         iptr_type _jpos = (iptr_type)-1 ;
-        iptr_type _kpos = (iptr_type)-1 ;
-           
-        if (this->_xvar == true)
+    
+        if (_xvar == true)
         {
             auto _joff = 
             algorithms::upper_bound (
-                this->_xpos.head(), 
-                this->_xpos.tend(), 
-            _xpos,std::less<real_type>());
+                _xset.head(), 
+                _xset.tend(), 
+            _xval,std::less<real_type>());
            
             _jpos = (iptr_type) (
-            _joff-this->_xpos.head() - 1);
+            _joff - _xset.head() - 1);
         }
         else
         {
             real_type _xmin, _xmax, _xdel;
-            _xmin = *this->_xpos.head();
-            _xmax = *this->_xpos.tail();
+            _xmin = *_xset.head();
+            _xmax = *_xset.tail();
             
             _xdel = (_xmax - _xmin) /
-                (this->_xpos.count() - 1);
+                (_xset.count() - 1);
             
             _jpos = (iptr_type)
-              ( (_xpos - _xmin) / _xdel );
+              ( (_xval - _xmin) / _xdel );
         }
         
-    /*---------------------------- find enclosing y-range */
-        if (this->_yvar == true)
-        {
-            auto _ioff = 
-            algorithms::upper_bound (
-                this->_ypos.head(), 
-                this->_ypos.tend(), 
-            _ypos,std::less<real_type>());
-           
-            _ipos = (iptr_type) (
-            _ioff-this->_ypos.head() - 1);
-        }
-        else
-        {
-            real_type _ymin, _ymax, _ydel;
-            _ymin = *this->_ypos.head();
-            _ymax = *this->_ypos.tail();
-            
-            _ydel = (_ymax - _ymin) /
-                (this->_ypos.count() - 1);
+        if (_jpos == 
+       (iptr_type)_xset.count() - 1)
+            _jpos = _jpos - 1 ;
             
-            _ipos = (iptr_type)
-              ( (_ypos - _ymin) / _ydel );
-        }
-        
-    /*---------------------------- find enclosing z-range */
-        if (this->_zvar == true )
+        return _jpos ;
+    }
+    
+    __normal_call void_type find_indx (
+        containers::array <
+        real_type, allocator>&_xset ,
+        bool_type             _xvar ,
+        iptr_type             _nblk ,
+        real_type const      *_xval ,
+        iptr_type            *_jval
+        )
+    {
+        if (_xvar == true)
         {
-            auto _koff = 
-            algorithms::upper_bound (
-                this->_zpos.head(), 
-                this->_zpos.tend(), 
-            _zpos,std::less<real_type>());
-           
-            _kpos = (iptr_type) (
-            _koff-this->_zpos.head() - 1);
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            _jval[_ipos] = find_indx(
+                _xset, _xvar, _xval[_ipos]) ;
         }
         else
         {
-            real_type _zmin, _zmax, _zdel;
-            _zmin = *this->_zpos.head();
-            _zmax = *this->_zpos.tail();
+    /*---------------------------- flat loop, as per SIMD */
+            real_type _xmin, _xmax, _xdel;
+            _xmin = *_xset.head();
+            _xmax = *_xset.tail();
             
-            _zdel = (_zmax - _zmin) /
-                (this->_zpos.count() - 1);
+            _xdel = (_xmax - _xmin) /
+                (_xset.count() - 1);
+                
+            iptr_type _xend = 
+           (iptr_type)_xset.count() - 1 ;
             
-            _kpos = (iptr_type)
-              ( (_zpos - _zmin) / _zdel );
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            {
+            _jval[_ipos] = (iptr_type)
+                ((_xval[_ipos] - _xmin) / _xdel) ;
+            _jval[_ipos] -= 
+                _jval[_ipos] == _xend ? 1 : 0 ;
+            }
         }
-        
-        if (_ipos == 
-       (iptr_type)this->_ypos.count() - 1)
-            _ipos = _ipos - 1 ;
-        
-        if (_jpos == 
-       (iptr_type)this->_xpos.count() - 1)
-            _jpos = _jpos - 1 ;
-            
-        if (_kpos == 
-       (iptr_type)this->_zpos.count() - 1)
-            _kpos = _kpos - 1 ;
-        
-    /*---------------------------- a linear interpolation */
+    }
+    
+    /*
+    --------------------------------------------------------
+     * EVAL-CELL: interpolate within the (i,j,k)-th cell.
+    --------------------------------------------------------
+     */
+    
+    __inline_call real_type eval_cell (
+        real_type  _xpos,
+        real_type  _ypos,
+        real_type  _zpos,
+        iptr_type  _ipos,
+        iptr_type  _jpos,
+        iptr_type  _kpos
+        )
+    {
         real_type _xx11 = 
             this->_xpos[_jpos + 0] ;
         real_type _xx22 = 
@@ -404,9 +367,309 @@
             _v122+_v212+_v221+_v222) ;
 
         return (  _hbar ) ;
-    }    
+    }
+    
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. value.
+    --------------------------------------------------------
+     */
+    
+    __inline_call real_type eval (
+        real_type *_ppos,
+        hint_type &_hint
+        )
+    {
+        real_type _hval = 
+    +std::numeric_limits<real_type>::infinity();
+    
+        __unreferenced (_hint) ;
+    
+        if (this->_xpos.count() == +0)
+            return _hval ;
+        
+        real_type _xpos = _ppos[0] ;
+        
+        if (_xpos < *this->_xpos.head() )
+            _xpos = *this->_xpos.head() ;
+        if (_xpos > *this->_xpos.tail() )
+            _xpos = *this->_xpos.tail() ;
+        
+        if (this->_ypos.count() == +0)
+            return _hval ;
+            
+        real_type _ypos = _ppos[1] ;
+            
+        if (_ypos < *this->_ypos.head() )
+            _ypos = *this->_ypos.head() ;
+        if (_ypos > *this->_ypos.tail() )
+            _ypos = *this->_ypos.tail() ;
+            
+        if (this->_zpos.count() == +0)
+            return _hval ;
+            
+        real_type _zpos = _ppos[2] ;
+            
+        if (_zpos < *this->_zpos.head() )
+            _zpos = *this->_zpos.head() ;
+        if (_zpos > *this->_zpos.tail() )
+            _zpos = *this->_zpos.tail() ;
+            
+    /*---------------------------- find enclosing xyz-cell */
+        iptr_type _jpos = find_indx(
+            this->_xpos, this->_xvar, _xpos) ;
+        iptr_type _ipos = find_indx(
+            this->_ypos, this->_yvar, _ypos) ;
+        iptr_type _kpos = find_indx(
+            this->_zpos, this->_zvar, _zpos) ;
+        
+    /*---------------------------- a linear interpolation */
+        return eval_cell(_xpos, _ypos, 
+            _zpos, _ipos, _jpos, _kpos) ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. over a set of points.
+    --------------------------------------------------------
+     *
+     * PPOS is a packed (x,y,z) array of NPTS points, with
+     * values returned in HVAL. Points are processed in
+     * blocks, with the clamping and uniform-axis indexing
+     * done as flat SoA loops for the compiler to vectorise.
+     *
+    --------------------------------------------------------
+     */
     
+    __normal_call void_type eval (
+        iptr_type        _npts ,
+        real_type const *_ppos ,
+        real_type       *_hval ,
+        hint_type       *_hint
+        )
+    {
+        iptr_type static 
+            constexpr _BLCK = +64 ;
+            
+        __unreferenced (_hint) ;
     
+        if (this->_xpos.count() == +0 ||
+            this->_ypos.count() == +0 ||
+            this->_zpos.count() == +0 )
+        {
+            for (auto _ipos = +0; 
+                _ipos < _npts; ++_ipos)
+            _hval[_ipos] = 
+                +std::numeric_limits
+                    <real_type>::infinity();
+                    
+            return ;
+        }
+        
+        real_type _xmin = *this->_xpos.head() ;
+        real_type _xmax = *this->_xpos.tail() ;
+        real_type _ymin = *this->_ypos.head() ;
+        real_type _ymax = *this->_ypos.tail() ;
+        real_type _zmin = *this->_zpos.head() ;
+        real_type _zmax = *this->_zpos.tail() ;
+        
+        real_type _xval[_BLCK] ;
+        real_type _yval[_BLCK] ;
+        real_type _zval[_BLCK] ;
+        iptr_type _jval[_BLCK] ;
+        iptr_type _ival[_BLCK] ;
+        iptr_type _kval[_BLCK] ;
+        
+        for (auto _ioff = +0; 
+            _ioff < _npts; _ioff += _BLCK)
+        {
+            iptr_type _nblk = std::min(
+                _npts - _ioff, _BLCK) ;
+            
+            real_type const *_pblk = 
+                _ppos + _ioff * 3 ;
+        
+    /*---------------------------- clamp to grid, as SoA */
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            {
+            _xval[_ipos] = std::min(std::max(
+                _pblk[_ipos*3+0], _xmin), _xmax) ;
+            _yval[_ipos] = std::min(std::max(
+                _pblk[_ipos*3+1], _ymin), _ymax) ;
+            _zval[_ipos] = std::min(std::max(
+                _pblk[_ipos*3+2], _zmin), _zmax) ;
+            }
+            
+    /*---------------------------- find enclosing xyz-cell */
+            find_indx(this->_xpos, this->_xvar, 
+                _nblk, _xval, _jval) ;
+            find_indx(this->_ypos, this->_yvar, 
+                _nblk, _yval, _ival) ;
+            find_indx(this->_zpos, this->_zvar, 
+                _nblk, _zval, _kval) ;
+            
+    /*---------------------------- a linear interpolation */
+            for (auto _ipos = +0; 
+                _ipos < _nblk; ++_ipos)
+            {
+            _hval[_ioff + _ipos] = eval_cell (
+                _xval[_ipos], _yval[_ipos], 
+                _zval[_ipos], _ival[_ipos], 
+                _jval[_ipos], _kval[_ipos]) ;
+            }
+        }
+    }
+    
+    
+    /*
+    --------------------------------------------------------
+     * CLIP: limit |dh/dx| over the grid.
+    --------------------------------------------------------
+     */
+    
+    class limit_grid
+        {
+    /*------------------------ grid "adaptor" for HJ-MESH */
+        public  :
+        typedef R                   real_type ;
+        typedef I                   iptr_type ;
+        typedef A                   allocator ;
+        
+        hfun_grid_euclidean_3d     *_hfun ;
+        
+        iptr_type                   _xnum ;
+        iptr_type                   _ynum ;
+        iptr_type                   _znum ;
+        
+        public  :
+        __inline_call iptr_type node_count (
+            ) const
+        {   return _xnum * _ynum * _znum ;
+        }
+        
+        __inline_call real_type&node_hval (
+            iptr_type _inod
+            )
+        {   return _hfun->_hmat[_inod] ;
+        }
+        
+        __inline_call void_type node_ppos (
+            iptr_type _inod ,
+            real_type*_ppos
+            ) const
+        {
+            iptr_type _xynn = _xnum*_ynum ;
+            iptr_type _kpos = _inod/_xynn ;
+            _inod = _inod - _kpos*_xynn ;
+            
+            _ppos[0] = _hfun->
+                _xpos[_inod / _ynum] ;
+            _ppos[1] = _hfun->
+                _ypos[_inod % _ynum] ;
+            _ppos[2] = _hfun->
+                _zpos[_kpos] ;
+        }
+        
+        __inline_call iptr_type node_indx (
+            iptr_type _ipos ,
+            iptr_type _jpos ,
+            iptr_type _kpos
+            ) const
+        {   return _kpos * _xnum * _ynum
+                 + _jpos * _ynum + _ipos ;
+        }
+        
+        template <
+        typename      func_type
+                 >
+        __inline_call void_type node_adjs (
+            iptr_type _inod ,
+            func_type&_func
+            ) const
+        {
+            iptr_type _xynn = _xnum*_ynum ;
+            iptr_type _kpos = _inod/_xynn ;
+            iptr_type _ipos =
+           (_inod - _kpos*_xynn) % _ynum ;
+            iptr_type _jpos =
+           (_inod - _kpos*_xynn) / _ynum ;
+        
+    /*------------------------ faces of adj. hexa.'s, and
+       the diagonals between opposite corners of each  */
+            for (auto _ioff = -1; 
+                      _ioff <= +1; _ioff += 2)
+            for (auto _joff = -1; 
+                      _joff <= +1; _joff += 2)
+            for (auto _koff = -1; 
+                      _koff <= +1; _koff += 2)
+            {
+                iptr_type _inew = _ipos+_ioff ;
+                iptr_type _jnew = _jpos+_joff ;
+                iptr_type _knew = _kpos+_koff ;
+            
+                if (_inew < +0 || 
+                    _inew >= _ynum) continue ;
+                if (_jnew < +0 || 
+                    _jnew >= _xnum) continue ;
+                if (_knew < +0 || 
+                    _knew >= _znum) continue ;
+                
+                iptr_type _bi00 = node_indx (
+                    _inew, _jpos, _kpos) ;
+                iptr_type _b0j0 = node_indx (
+                    _ipos, _jnew, _kpos) ;
+                iptr_type _b00k = node_indx (
+                    _ipos, _jpos, _knew) ;
+                
+                iptr_type _fij0 = node_indx (
+                    _inew, _jnew, _kpos) ;
+                iptr_type _fi0k = node_indx (
+                    _inew, _jpos, _knew) ;
+                iptr_type _f0jk = node_indx (
+                    _ipos, _jnew, _knew) ;
+                
+                iptr_type _cijk = node_indx (
+                    _inew, _jnew, _knew) ;
+                
+                _func(_bi00, _fij0) ;
+                _func(_fij0, _b0j0) ;
+                _func(_bi00, _b0j0) ;
+                
+                _func(_bi00, _fi0k) ;
+                _func(_fi0k, _b00k) ;
+                _func(_bi00, _b00k) ;
+                
+                _func(_b0j0, _f0jk) ;
+                _func(_f0jk, _b00k) ;
+                _func(_b0j0, _b00k) ;
+                
+                _func(_cijk,   -1 ) ;
+            }
+        }
+        } ;
+    
+    __normal_call void_type clip (
+        real_type _dhdx
+        )
+    {
+        limit_grid _ffun ;
+        _ffun._hfun = this ;
+        _ffun._xnum = 
+       (iptr_type)this->_xpos.count() ;
+        _ffun._ynum = 
+       (iptr_type)this->_ypos.count() ;
+        _ffun._znum = 
+       (iptr_type)this->_zpos.count() ;
+        
+        if (_ffun.node_count() != 
+       (iptr_type)this->_hmat.count())
+            return ;
+        
+        hj_mesh_2<limit_grid>::
+            limit_mesh(_ffun, _dhdx) ;
+    }
+
     } ;
     
     
@@ -119,6 +119,10 @@
                 + 3 ,
                 tree_node,
                 allocator       >   tree_type ; 
+                
+    typedef containers::array <
+                iptr_type ,
+                allocator       >   iptr_list ;
               
     public  :              
     
@@ -131,6 +135,8 @@
    
     mesh_type                      _mesh ;
     tree_type                      _tree ;
+    
+    iptr_list                      _tadj ;
   
     public  :
 
@@ -229,6 +235,8 @@
                   this->_mesh._set4 , 
                   this->_tree,_BTOL ,
                  _NBOX , tria_pred()) ;
+                 
+        this->_tree.freeze() ;  // cache-linear queries
     
    /*--------------------- flip node order - orientations */    
         for (auto _tpos  = 
@@ -256,6 +264,116 @@
                       _tpos->node (1)) ;
             }
         }
+
+    /*-------------------- tria-to-tria adj. for walking */
+        init_adj () ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * INIT-ADJ: make tria-to-tria adj., via sorted faces.
+    --------------------------------------------------------
+     */
+     
+    class face_data
+        {
+        public  :
+        iptr_type                     _node[3] ;
+        iptr_type                     _tpos ;
+        iptr_type                     _fpos ;
+        } ;
+        
+    class face_less
+        {
+        public  :
+        __inline_call bool_type operator() (
+            face_data const&_idat ,
+            face_data const&_jdat
+            ) const
+        {
+            for (auto _inod = +0; _inod != +3; 
+                    ++_inod)
+            {
+            if (_idat._node[_inod] != 
+                _jdat._node[_inod] )
+            return _idat._node[_inod] < 
+                   _jdat._node[_inod] ;
+            }
+            return false ;
+        }
+        } ;
+     
+    __normal_call void_type init_adj (
+        )
+    {
+        containers::array<face_data> _fset ;
+    
+        this->_tadj.set_count(
+            this->_mesh._set4.count() * 4,
+        containers::tight_alloc, -1) ;
+    
+    /*-------------------- list faces of all "live" cells */
+        iptr_type _tpos = +0 ;
+        for (auto _iter  = 
+             this->_mesh._set4.head() ;
+                  _iter != 
+             this->_mesh._set4.tend() ;
+                ++_iter, ++_tpos)
+        {
+            if (_iter->mark() < +0) continue ;
+            
+            for (auto _fpos = +4; _fpos-- != +0; )
+            {
+                iptr_type _fnod[4] ;
+                tri4_type::
+                face_node(_fnod, _fpos, 3, 2) ;
+            
+                face_data _fdat ;
+                _fdat._node[0] = 
+                    _iter->node(_fnod[0]) ;
+                _fdat._node[1] = 
+                    _iter->node(_fnod[1]) ;
+                _fdat._node[2] = 
+                    _iter->node(_fnod[2]) ;
+                algorithms::isort (
+                    &_fdat._node[0], 
+                    &_fdat._node[3], 
+                        std::less<iptr_type>()) ;
+                _fdat._tpos = _tpos ;
+                _fdat._fpos = _fpos ;
+                
+                _fset.push_tail(_fdat) ;
+            }
+        }
+        
+        algorithms::qsort(_fset.head(), 
+            _fset.tend(), face_less()) ;
+            
+    /*-------------------- match equal faces as adjacent */
+        for (auto _iter  = _fset.head() ; 
+                  _iter != _fset.tend() ; 
+                ++_iter  )
+        {
+            auto _next = _iter + 1 ;
+            
+            if (_next == _fset.tend()) break;
+            
+            if (
+                _iter->_node[0] == 
+                _next->_node[0] &&
+                _iter->_node[1] == 
+                _next->_node[1] &&
+                _iter->_node[2] == 
+                _next->_node[2] )
+            {
+                this->_tadj[_iter->_tpos * 4 
+                          + _iter->_fpos] = 
+                            _next->_tpos ;
+                this->_tadj[_next->_tpos * 4 
+                          + _next->_fpos] = 
+                            _iter->_tpos ;
+            }
+        }
     }
     
     /*
@@ -364,6 +482,77 @@
         return  true ;
     }
    
+    /*
+    --------------------------------------------------------
+     * WALK-TRIA: visibility walk from TPOS toward PPOS.
+    --------------------------------------------------------
+     *
+     * Steps across the face most "behind" PPOS until all
+     * faces pass the FIND-PRED test. Returns FALSE if the
+     * walk leaves the mesh, or doesn't settle in _WMAX
+     * steps, in which case callers fall back on the tree.
+     *
+    --------------------------------------------------------
+     */
+     
+    __normal_call bool_type walk_tria (
+        real_type *_ppos ,
+        iptr_type &_tpos
+        )
+    {
+        iptr_type static constexpr _WMAX = +64 ;
+        
+        if (this->_tadj.empty()) 
+            return find_pred( 
+                _ppos, &_mesh, _tpos, this->_vtol) ;
+    
+        for (auto _iter = +0; _iter++ != _WMAX; )
+        {
+            iptr_type _fmin = -1 ;
+            real_type _vmin = -this->_vtol ;
+        
+            for (auto _fpos = +4; _fpos-- != +0; )
+            {
+            iptr_type _fnod[ 4];
+            tri4_type::
+                face_node(_fnod, _fpos, 3, 2);
+            _fnod[0] = this->_mesh.
+            _set4[_tpos].node(_fnod[0]);
+            _fnod[1] = this->_mesh.
+            _set4[_tpos].node(_fnod[1]);
+            _fnod[2] = this->_mesh.
+            _set4[_tpos].node(_fnod[2]);
+            
+            real_type _tvol = 
+                geometry::tetra_vol_3d (
+               &this->_mesh.
+               _set1[ _fnod[0]].pval(0),
+               &this->_mesh.
+               _set1[ _fnod[1]].pval(0),
+               &this->_mesh.
+               _set1[ _fnod[2]].pval(0),
+               _ppos) ;
+               
+            if (_tvol < _vmin)
+            {
+                _vmin = _tvol ;
+                _fmin = _fpos ;
+            }
+            }
+            
+            if (_fmin == -1) return true ;
+            
+            iptr_type _tnxt = this->
+                _tadj[_tpos * 4 + _fmin] ;
+            
+            if (_tnxt <  +0) return false;
+            
+            _tpos = _tnxt ;
+        }
+        
+        return false ;
+    }
+   
     /*
     --------------------------------------------------------
      * HINT: check for valid index.
@@ -394,15 +583,10 @@
         )
     /*------------------------ find tria + linear interp. */
     {
-        real_type _hval = 
-    +std::numeric_limits<real_type>::infinity() ;
-    
         if (hint_okay(_hint))
         {
-    /*------------------------ test whether hint is valid */
-            if(!find_pred( _ppos, 
-                   &_mesh, _hint,
-                this->_vtol ) )
+    /*------------------------ walk from hint to ppos. */
+            if(!walk_tria(_ppos, _hint))
             {
             _hint =  this->null_hint();
             }
@@ -429,7 +613,24 @@
             hfun_type::null_hint () ;
         }
     
-        if (_hint != this->null_hint())
+        return eval_tria(_ppos, _hint) ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * EVAL-TRIA: interp. (or extrap.) from TRIA to PPOS.
+    --------------------------------------------------------
+     */
+     
+    __normal_call real_type eval_tria (
+        real_type *_ppos ,
+        iptr_type  _tria
+        )
+    {
+        real_type _hval = 
+    +std::numeric_limits<real_type>::infinity() ;
+    
+        if (_tria != this->null_hint())
         {
     /*------------------------ linear interp. within tria */
         real_type _hsum = (real_type)+.0 ;
@@ -441,13 +642,13 @@
             tri4_type::
             face_node(_fnod, _fpos, 3, 2) ;
             _fnod[0] = this->_mesh.
-            _set4[_hint].node(_fnod[0]);
+            _set4[_tria].node(_fnod[0]);
             _fnod[1] = this->_mesh.
-            _set4[_hint].node(_fnod[1]);
+            _set4[_tria].node(_fnod[1]);
             _fnod[2] = this->_mesh.
-            _set4[_hint].node(_fnod[2]);
+            _set4[_tria].node(_fnod[2]);
             _fnod[3] = this->_mesh.
-            _set4[_hint].node(_fnod[3]);
+            _set4[_tria].node(_fnod[3]);
             
             real_type _tvol = 
                 geometry::tetra_vol_3d (
@@ -542,6 +743,257 @@
         return  _hval ;  
     }
     
+    
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. over a set of points.
+    --------------------------------------------------------
+     *
+     * PPOS is a packed (x,y,z) array of NPTS points, with
+     * values returned in HVAL. HINT is optional, and is 
+     * both read and updated per point if non-null, so 
+     * that callers can keep their hints across calls.
+     * Points with stale hints are located together, via
+     * a packet search of the tree.
+     *
+    --------------------------------------------------------
+     */
+    
+    __normal_call void_type eval (
+        iptr_type        _npts ,
+        real_type const *_ppos ,
+        real_type       *_hval ,
+        hint_type       *_hint
+        )
+    {
+        if (_npts <= +0) return ;
+    
+        containers::array<real_type> _pset ;
+        containers::array<hint_type> _hset ;
+        
+        containers::array<iptr_type> _list ;
+        containers::array<tree_pred> _pred ;
+        containers::array<find_tria> _func ;
+        
+        _pset.set_count(_npts * 3) ;
+        _hset.set_count(_npts * 1) ;
+        
+        std::copy(_ppos, 
+            _ppos + _npts * 3, &_pset[0]) ;
+        
+    /*------------------------ test hints, list the misses */
+        for (auto _ipos = +0; 
+            _ipos < _npts; ++_ipos)
+        {
+            real_type *_pval = &_pset[_ipos * 3] ;
+        
+            hint_type  _hnow = _hint != nullptr ? 
+                _hint[_ipos] : this->null_hint() ;
+                
+            if (!hint_okay(_hnow) ||
+                !walk_tria(_pval, _hnow) )
+            {
+                _hnow = this->null_hint() ;
+            
+                _list.push_tail(_ipos) ;
+                _pred.push_tail(
+                    tree_pred(_pval)) ;
+                _func.push_tail(find_tria(
+                    _pval, &_mesh, this->_vtol)) ;
+            }
+            
+            _hset[_ipos] = _hnow ;
+        }
+        
+    /*------------------------ packet search for the rest */
+        if (!_list.empty())
+        {
+            this->_tree.find(
+               (iptr_type)_list.count(), 
+                &_pred[0], &_func[0]) ;
+                
+            for (auto _ipos = +0; 
+                _ipos < (iptr_type)_list.count() ; 
+                    ++_ipos )
+            {
+                _hset[_list[_ipos]] = 
+                    _func[_ipos]._find ? 
+                    _func[_ipos]._tpos : 
+                    this->null_hint () ;
+            }
+        }
+        
+    /*------------------------ interp. at points, in || */
+#       ifdef  __use_openmp
+        #pragma omp parallel for schedule(static) \
+            if (_npts >= +1024)
+#       endif//__use_openmp
+        for (iptr_type _ipos = +0; 
+                _ipos < _npts; ++_ipos)
+        {
+            _hval[_ipos] = eval_tria(
+               &_pset[_ipos * 3], _hset[_ipos]) ;
+        }
+        
+        if (_hint != nullptr)
+        std::copy(&_hset[0], 
+            &_hset[0] + _npts, _hint) ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * CLIP: limit |dh/dx| over the mesh.
+    --------------------------------------------------------
+     */
+    
+    class limit_tria
+        {
+    /*------------------------ mesh "adaptor" for HJ-MESH */
+        public  :
+        typedef R                   real_type ;
+        typedef I                   iptr_type ;
+        typedef A                   allocator ;
+        
+        mesh_type                  *_mesh ;
+        
+        containers::array <
+            iptr_type, allocator>  _aptr ;
+        containers::array <
+            iptr_type, allocator>  _aidx ;
+        
+        public  :
+        __inline_call iptr_type node_count (
+            ) const
+        {   return (iptr_type)
+                _mesh->_set1.count() ;
+        }
+        
+        __inline_call real_type&node_hval (
+            iptr_type _inod
+            )
+        {   return _mesh->_set1[_inod].hval() ;
+        }
+        
+        __inline_call void_type node_ppos (
+            iptr_type _inod ,
+            real_type*_ppos
+            ) const
+        {
+            _ppos[0] = 
+            _mesh->_set1[_inod].pval(0) ;
+            _ppos[1] = 
+            _mesh->_set1[_inod].pval(1) ;
+            _ppos[2] = 
+            _mesh->_set1[_inod].pval(2) ;
+        }
+        
+        template <
+        typename      func_type
+                 >
+        __inline_call void_type node_adjs (
+            iptr_type _inod ,
+            func_type&_func
+            ) const
+        {
+            for (auto _ipos = _aptr[_inod+0];
+                      _ipos < _aptr[_inod+1];
+                    ++_ipos )
+            {
+                iptr_type _tpos = _aidx[_ipos];
+            
+                iptr_type _tnod[4] ;
+                _tnod[0] = _mesh->
+                    _set4[_tpos].node(0);
+                _tnod[1] = _mesh->
+                    _set4[_tpos].node(1);
+                _tnod[2] = _mesh->
+                    _set4[_tpos].node(2);
+                _tnod[3] = _mesh->
+                    _set4[_tpos].node(3);
+                
+                iptr_type _jnod[3], _jnum = +0 ;
+                for (auto _ii = +0; _ii < +4; ++_ii)
+                if (_tnod[_ii] != _inod)
+                {
+                    _jnod[_jnum++] = _tnod[_ii] ;
+                }
+                
+                _func(_jnod[0], _jnod[1]) ;
+                _func(_jnod[1], _jnod[2]) ;
+                _func(_jnod[2], _jnod[0]) ;
+            }
+        }
+        } ;
+    
+    __normal_call void_type clip (
+        real_type _dhdx
+        )
+    {
+        limit_tria _ffun ;
+        _ffun._mesh = &this->_mesh ;
+        
+    /*------------------------ build node-to-tria adj. */
+        _ffun._aptr.set_count (
+            this->_mesh._set1.count() + 1 , 
+            containers::tight_alloc, +0) ;
+        
+        iptr_type _tpos  = +0 ;
+        for (auto _iter  = 
+             this->_mesh._set4.head() ;
+                  _iter != 
+             this->_mesh._set4.tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() < +0) continue ;
+            
+            _ffun._aptr[_iter->node(0)+1] += 1;
+            _ffun._aptr[_iter->node(1)+1] += 1;
+            _ffun._aptr[_iter->node(2)+1] += 1;
+            _ffun._aptr[_iter->node(3)+1] += 1;
+        }
+        
+        for (auto _iter  = 
+            _ffun._aptr.head() + 1 ;
+                  _iter != 
+            _ffun._aptr.tend() ;
+                ++_iter  )
+        {
+            *_iter += *(_iter - 1) ;
+        }
+        
+        _ffun._aidx.set_count (
+           *_ffun._aptr.tail(),
+            containers::tight_alloc, -1) ;
+        
+        for (auto _iter  = 
+             this->_mesh._set4.head() ;
+                  _iter != 
+             this->_mesh._set4.tend() ;
+                ++_iter, ++_tpos )
+        {
+            if (_iter->mark() < +0) continue ;
+            
+            for (auto _inod = +4; _inod-- != +0; )
+            {
+            _ffun._aidx[_ffun.
+            _aptr[_iter->node(_inod)]++] = _tpos ;
+            }
+        }
+        
+        for (auto _iter  = 
+            _ffun._aptr.tail() ;
+                  _iter != 
+            _ffun._aptr.head() ;
+                --_iter  )
+        {
+            *_iter  = *(_iter - 1) ;
+        }
+        *_ffun._aptr.head() = +0 ;
+    
+        hj_mesh_2<limit_tria>::
+            limit_mesh(_ffun, _dhdx) ;
+    }
+
     } ;
 
 
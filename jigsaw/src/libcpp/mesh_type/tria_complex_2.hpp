@@ -318,23 +318,23 @@
     typedef allocators::_wrap_alloc <
                 pool_base           >   pool_wrap ;
 
-    typedef containers::hash_table  <
+    typedef containers::hash_flat   <
                 iptr_type, 
                 node_hash, 
                 node_pred,
-                pool_wrap>              node_maps ;
+                allocator>              node_maps ;
 
-    typedef containers::hash_table  <
+    typedef containers::hash_flat   <
                 iptr_type, 
                 edge_hash, 
                 edge_pred,
-                pool_wrap>              edge_maps ;
+                allocator>              edge_maps ;
                 
-    typedef containers::hash_table  <
+    typedef containers::hash_flat   <
                 iptr_type, 
                 tri3_hash, 
                 tri3_pred,
-                pool_wrap>              tri3_maps ;
+                allocator>              tri3_maps ;
                 
     typedef containers::array_list  <
                 iptr_type,
@@ -342,7 +342,6 @@
 
     public  :
 
-    pool_base                   _hsrc ;
     pool_base                   _csrc ;
 
     conn_list                   _adj1 ;
@@ -498,9 +497,7 @@
      
     __normal_call tria_complex_2 (
         allocator const& _asrc = allocator()
-        ) : _hsrc(sizeof (
-            typename tri3_maps::item_type)),
-            _csrc(sizeof (
+        ) : _csrc(sizeof (
             typename conn_list::item_type)),
         /*------------------------------ init. adj. lists */
             _adj1(pool_wrap(&_csrc)),
@@ -510,15 +507,15 @@
             _map1(
              node_hash(& this->_set1) , 
              node_pred(& this->_set1) , 
-            +.8, (pool_wrap(&_hsrc))) ,
+            +.8,  _asrc) ,
             _map2(
              edge_hash(& this->_set2) , 
              edge_pred(& this->_set2) , 
-            +.8, (pool_wrap(&_hsrc))) ,
+            +.8,  _asrc) ,
             _map3(
              tri3_hash(& this->_set3) , 
              tri3_pred(& this->_set3) , 
-            +.8, (pool_wrap(&_hsrc))) ,
+            +.8,  _asrc) ,
         /*------------------------------ init. face lists */
             _set1(_asrc),_set2(_asrc) ,
             _set3(_asrc),
@@ -55,6 +55,9 @@
 #   include "meshtype.hpp"
 
 #   include "mesh_func/hfun_base_k.hpp"
+#   include "mesh_func/hfun_copy_k.hpp"
+
+#   include "hj_solver/hj_solver_2.hpp"
 
 #   include "mesh_func/hfun_constant_value_k.hpp"
 
@@ -368,52 +368,10 @@
         iptr_list &_iset
         )
     {
-        typedef geom_tree::aabb_node_base_k     
-                           tree_node ;
-
-        typedef geom_tree::aabb_item_node_k <
-            real_type,
-            iptr_type, 2>  tree_item ;
-                    
-        typedef geom_tree::aabb_tree <
-            tree_item, 2,
-            tree_node,
-            allocator   >  tree_type ;
-                
-        containers::array<tree_item> _bbox;
-       
-    /*------------------------------ initialise aabb-tree */ 
-        iptr_type _npos  = 0 ;
-        tree_type _tree  ;
-        for (auto _node  = 
-            _init._mesh._set1.head() ; 
-                  _node != 
-            _init._mesh._set1.tend() ;
-                ++_node, ++_npos)
-        {
-            if (_node->mark() >= +0)
-            {
-            
-            _bbox.push_tail() ;
-            _bbox.tail()->
-                pval(0) = _node->pval( 0) ;
-            _bbox.tail()->
-                pval(1) = _node->pval( 1) ;
-  
-            _bbox.tail()->
-                ipos () = _npos ;
-            
-            }
-        }
-       
-        iptr_type _NBOX = 
-            (iptr_type) std::pow (8, 2) ;       // 8^ndim
-       
-        _tree.load(_bbox.head(),
-                   _bbox.tend(), _NBOX) ;
-        
-    /*------------------------------ randomised tree sort */    
-        _tree.brio(_iset) ;
+    /*------------------------------ Hilbert-sorted BRIO */
+        algorithms::brio_sort<real_type> ( 2,
+            _init._mesh._set1.head() ,
+            _init._mesh._set1.tend() , _iset) ;
     }
 
     template <
@@ -634,11 +592,10 @@
         jlog_file &_dump
         )
     {   
-    /*------------------------------ ensure deterministic */  
-        std::srand( +1 ) ;
-
         rdel_stat  _tcpu ;
 
+        _tcpu.pred_init() ;
+
     #   ifdef  __use_timers
         typename std ::chrono::
         high_resolution_clock::
@@ -826,6 +783,8 @@
         _dump.push("\n")  ;
         _dump.push("\n")  ;
         
+        _tcpu.pred_dump(_dump) ;
+        
         }
         
         _dump.push("\n")  ;
@@ -136,6 +136,9 @@
     typedef typename 
             allocator::size_type            uint_type ;
 
+    typedef mesh::hfun_copy_kd <
+                hfun_type      >            hfun_copy ;
+
     typedef char_type  mode_type ;
     
     char_type static constexpr null_mode = +0 ;
@@ -144,6 +147,9 @@
     char_type static constexpr etop_mode = +3 ;
     char_type static constexpr tria_mode = +4 ;
 
+/*-------- min. cavity size for || rDT classification */
+    uint_type static constexpr bulk_size = +1024 ;
+
     class node_pred ; class ball_pred ; 
     class edge_pred ; class tria_pred ;
     
@@ -262,6 +268,22 @@
         }
         } ;
 
+    class bulk_list
+        {
+    /*---------------------- cavity lists, batched pass */
+        public  :
+        iptr_list               _nnew, _nold ;
+        iptr_list               _tnew, _told ;
+
+        escr_list               _escr ;
+        tscr_list               _tscr ;
+        ball_list               _bscr ;
+
+        edat_list               _edat, _eprv ;
+        tdat_list               _tdat ;
+        ball_list               _bdat ;
+        } ;
+
 
     /*
     --------------------------------------------------------
@@ -329,126 +351,176 @@
 
     /*
     --------------------------------------------------------
-     * TRIM-EEPQ: prune null edges from queues. 
+     * TRIM-XXPQ: prune null items from queues. 
+    --------------------------------------------------------
+     * PQ items are stamped with the PASS of the rDT face
+     * they were made from, and "stale" items are skipped
+     * lazily as they reach the root. The queues are only
+     * compacted once they have grown to NLIM, with NLIM
+     * reset to twice the live count after each sweep, so
+     * that the pruning is amortised O(log(N)) per item.
+     * Topo. queues hold a node at most once (via EMRK,
+     * FMRK), and only lose items to DT roll-backs.
     --------------------------------------------------------
      */
 
-    __static_call
-    __normal_call void_type trim_eepq (
-        mesh_type &_mesh,
-        edge_heap &_eepq
-        )
-    {
-        if(!_eepq.empty())
+    class node_dead
         {
+    /*---------------------- TRUE if topo. node is "dead" */
+        public  :
+        mesh_type              *_mesh ;
+        iptr_list              *_mark ;
 
-        iptr_type _dead = +0 ;
-        iptr_type _okay = +0 ;
+        __inline_call node_dead (
+            mesh_type *_msrc ,
+            iptr_list *_mmrk
+            ) : _mesh(_msrc), _mark(_mmrk) {}
 
-        for (auto _hpos = _eepq.count() - 1 ; 
-                  _hpos > +0 ; 
-                --_hpos )
+        __inline_call bool_type operator() (
+            node_data const& _ndat
+            ) const
         {
-            if (_okay > +1024 && 
-                    _dead < _okay / 4) break;
+            iptr_type _npos = _ndat._node[0] ;
 
-            iptr_type _pass;
-            edge_data _edat;
-            _edat._node[0] = 
-            _eepq. peek(_hpos)._node[0];
-            _edat._node[1] = 
-            _eepq. peek(_hpos)._node[1];
+            if (_mesh->_tria.
+                node(_npos)->mark() >= +0)
+                return false ;
+
+    /*---------------------- free mark, as when popped */
+            (*_mark)[_npos] = -1 ;
+            
+            return true ;
+        }
+        } ;
+
+    class ball_dead
+        {
+    /*---------------------- TRUE if ball item is "stale" */
+        public  :
+        mesh_type              *_mesh ;
+
+        __inline_call ball_dead (
+            mesh_type *_msrc
+            ) : _mesh(_msrc) {}
+
+        __inline_call bool_type operator() (
+            ball_data const& _bdat
+            ) const
+        {
+            typename mesh_type::
+                     ball_list::
+                 item_type *_bptr = nullptr ;
+            if(!_mesh->find_ball(
+                    _bdat, _bptr) ) return true ;
+
+            return _bptr->_data._pass != 
+                   _bdat. _pass ;
+        }
+        } ;
+
+    class edge_dead
+        {
+    /*---------------------- TRUE if edge item is "stale" */
+        public  :
+        mesh_type              *_mesh ;
 
-            _pass = 
-            _eepq. peek(_hpos)._pass ;
+        __inline_call edge_dead (
+            mesh_type *_msrc
+            ) : _mesh(_msrc) {}
+
+        __inline_call bool_type operator() (
+            edge_cost const& _cost
+            ) const
+        {
+            edge_data _edat;
+            _edat._node[0] = _cost._node[0] ;
+            _edat._node[1] = _cost._node[1] ;
 
             typename mesh_type::
                      edge_list::
                  item_type *_eptr = nullptr ;
-            if(!_mesh.find_edge(_edat,_eptr))
-            {
-                _eepq._pop(_hpos) ;
-
-                _dead += +1 ;
-            }
-            else
-            if (_eptr->_data._pass != _pass )
-            {
-                _eepq._pop(_hpos) ;
+            if(!_mesh->find_edge(
+                    _edat, _eptr) ) return true ;
 
-                _dead += +1 ;
-            }
-            else
-            {
-                _okay += +1 ;
-            }
+            return _eptr->_data._pass != 
+                   _cost. _pass ;
         }
+        } ;
+
+    class tria_dead
+        {
+    /*---------------------- TRUE if tria item is "stale" */
+        public  :
+        mesh_type              *_mesh ;
+
+        __inline_call tria_dead (
+            mesh_type *_msrc
+            ) : _mesh(_msrc) {}
+
+        __inline_call bool_type operator() (
+            tria_cost const& _cost
+            ) const
+        {
+            tria_data _tdat;
+            _tdat._node[0] = _cost._node[0] ;
+            _tdat._node[1] = _cost._node[1] ;
+            _tdat._node[2] = _cost._node[2] ;
+
+            typename mesh_type::
+                     tria_list::
+                 item_type *_tptr = nullptr ;
+            if(!_mesh->find_tria(
+                    _tdat, _tptr) ) return true ;
+
+            return _tptr->_data._pass != 
+                   _cost. _pass ;
         }
+        } ;
+
+    template <
+    typename      heap_type ,
+    typename      dead_type
+             >
+    __static_call
+    __normal_call void_type trim_heap (
+        heap_type &_heap,
+        dead_type  _dead,
+        std::size_t &_nlim
+        )
+    {
+        std::size_t static const _nmin = +1024 ;
+
+        if (_heap.count() <= _nlim) return ;
+
+        _heap._pop_test (_dead) ;
         
-        trim_list ( _eepq ) ;
+        trim_list ( _heap ) ;
+
+        _nlim = std::max(
+            _nmin, _heap.count() * +2) ;
     }
 
     /*
     --------------------------------------------------------
-     * TRIM-TTPQ: prune null tria. from queues. 
+     * PUSH-LIST: append one cavity list onto another.
     --------------------------------------------------------
      */
 
+    template <
+    typename      list_type
+             >
     __static_call
-    __normal_call void_type trim_ttpq (
-        mesh_type &_mesh,
-        tria_heap &_ttpq
+    __inline_call void_type push_list (
+        list_type &_ldst ,
+        list_type &_lsrc
         )
     {
-        if(!_ttpq.empty())
-        {
-
-        iptr_type _dead = +0 ;
-        iptr_type _okay = +0 ;
-
-        for (auto _hpos = _ttpq.count() - 1 ; 
-                  _hpos > +0 ; 
-                --_hpos )
+        for (auto _iter  = _lsrc.head() ;
+                  _iter != _lsrc.tend() ;
+                ++_iter  )
         {
-            if (_okay > +1024 && 
-                    _dead < _okay / 4) break;
-
-            iptr_type _pass;
-            tria_data _tdat;
-            _tdat._node[0] = 
-            _ttpq. peek(_hpos)._node[0];
-            _tdat._node[1] = 
-            _ttpq. peek(_hpos)._node[1];
-            _tdat._node[2] = 
-            _ttpq. peek(_hpos)._node[2];
-
-            _pass = 
-            _ttpq. peek(_hpos)._pass ;
-
-            typename mesh_type::
-                     tria_list::
-                 item_type *_tptr = nullptr ;
-            if(!_mesh.find_tria(_tdat,_tptr))
-            {
-                _ttpq._pop(_hpos);
-
-                _dead += +1 ;
-            }
-            else
-            if (_tptr->_data._pass != _pass )
-            {
-                _ttpq._pop(_hpos);
-
-                _dead += +1 ;
-            }
-            else
-            {
-                _okay += +1 ;
-            }
-        }
+            _ldst.push_tail( *_iter ) ;
         }
-        
-        trim_list ( _ttpq ) ;
     }
 
     /*
@@ -504,6 +576,7 @@
         push_rdel( _geom, _hfun, 
             _mesh, _init, 
             _nnew, _tnew, 
+               -1, 
             _escr, _ecav, 
             _tscr, _tcav,
             _bscr, _bcav,    
@@ -526,52 +599,10 @@
         iptr_list &_iset
         )
     {
-        typedef geom_tree::aabb_node_base_k     
-                           tree_node ;
-
-        typedef geom_tree::aabb_item_node_k <
-            real_type,
-            iptr_type, 2>  tree_item ;
-                    
-        typedef geom_tree::aabb_tree <
-            tree_item, 2,
-            tree_node,
-            allocator   >  tree_type ;
-                
-        containers::array<tree_item> _bbox;
-       
-    /*------------------------------ initialise aabb-tree */ 
-        iptr_type _npos  = 0 ;
-        tree_type _tree  ;
-        for (auto _node  = 
-            _init._mesh._set1.head() ; 
-                  _node != 
-            _init._mesh._set1.tend() ;
-                ++_node, ++_npos)
-        {
-            if (_node->mark() >= +0)
-            {
-            
-            _bbox.push_tail() ;
-            _bbox.tail()->
-                pval(0) = _node->pval( 0) ;
-            _bbox.tail()->
-                pval(1) = _node->pval( 1) ;
-  
-            _bbox.tail()->
-                ipos () = _npos ;
-            
-            }
-        }
-       
-        iptr_type _NBOX = 
-            (iptr_type) std::pow (8, 2) ;       // 8^ndim
-       
-        _tree.load(_bbox.head(),
-                   _bbox.tend(), _NBOX) ;
-        
-    /*------------------------------ randomised tree sort */    
-        _tree.brio(_iset) ;
+    /*------------------------------ Hilbert-sorted BRIO */
+        algorithms::brio_sort<real_type> ( 2,
+            _init._mesh._set1.head() ,
+            _init._mesh._set1.tend() , _iset) ;
     }
 
     template <
@@ -827,11 +858,10 @@
         __unreferenced(_time) ; // why does MSVC need this??
     #   endif//__use_timers
 
-    /*------------------------------ ensure deterministic */  
-        std::srand( +1 ) ;
-
         rdel_stat _tcpu  ;
 
+        _tcpu.pred_init() ;
+
     /*------------------------------ init. list workspace */
         iptr_list _nnew, _nold ;
         iptr_list _tnew, _told ;
@@ -846,11 +876,19 @@
         tdat_list _tdat  ;
         ball_list _bdat  ;
 
+        bulk_list _bulk  ;       // cavity lists, batch
+        iptr_list _nmrk  ;       // batch stamp per node
+
     /*------------------------------ refinement p.-queues */
         edge_heap _eepq  ;
         tria_heap _ttpq  ;
         node_heap _etpq  ;
         ball_heap _nbpq  ;
+
+        std::size_t _nblim = +1024 ; // size for next trim
+        std::size_t _eelim = +1024 ;
+        std::size_t _ttlim = +1024 ;
+        std::size_t _etlim = +1024 ;
  
     /*------------------------------ alloc. for hash obj. */
         _mesh._eset._lptr. set_count (
@@ -909,6 +947,8 @@
 
     /*-------------------- main: refine edges/faces/trias */
         iptr_type _pass  =   +0  ;
+        iptr_type _ilog  =   +0  ;       // since last log
+        iptr_type _itrm  =   +0  ;       // since last trim
     
         for(bool_type _done=false; !_done ; )
         {
@@ -920,6 +960,10 @@
     #       endif
 
             if(++_pass>_args.iter()) break;
+
+            _ilog += +1 ; _itrm += +1 ;
+
+            iptr_type _bmrk  = _pass ;
         
         /*------------------------- init. array workspace */
             
@@ -1128,11 +1172,74 @@
                     _hfun, _mesh, _mode, 
                     _epro, _nnew, _nold,
                     _tnew, _told, _ttpq, 
+                    _nmrk, _bmrk,
                     _eprv, _edat, _escr,
                     _tdat, _tscr, 
                     _bdat, _bscr, _tdim, 
                     _pass, _args) ;
 
+                if (_kind != rdel_opts::null_kind &&
+                    _args.bulk() > +1)
+                {
+        /*----------------------------- batch disjoint trias */
+                bulk_mark(_mesh, _nmrk, _tnew, _bmrk) ;
+
+                for (auto _bnum = +1 ; 
+                          _bnum < _args.bulk() ; 
+                        ++_bnum )
+                {
+                    if (_ttpq.empty() || 
+                       !_escr.empty() ||
+                       !_bscr.empty() ||
+                        _pass >= _args.iter() )
+                        break ;
+
+                    char_type _bdim = -1 ;
+                    typename rdel_opts::node_kind
+                    _bknd =_bad_tria( _geom, 
+                        _hfun, _mesh, _mode, 
+                        _epro, 
+                        _bulk._nnew, _bulk._nold,
+                        _bulk._tnew, _bulk._told,
+                        _ttpq, _nmrk, _bmrk,
+                        _bulk._eprv, _bulk._edat, 
+                        _bulk._escr, 
+                        _bulk._tdat, _bulk._tscr, 
+                        _bulk._bdat, _bulk._bscr, 
+                        _bdim, _pass + 1, _args) ;
+
+                    if (_bknd != rdel_opts::null_kind)
+                    {
+        /*----------------------------- accept batch node */
+                        _pass += +1 ;
+                        
+                        _ilog += +1 ; _itrm += +1 ;
+                    
+                        if (_bdim == +1) 
+                            _enod[_bknd] += +1 ;
+                        else
+                        if (_bdim == +2) 
+                            _tnod[_bknd] += +1 ;
+
+                        bulk_mark(_mesh, _nmrk, 
+                            _bulk._tnew, _bmrk) ;
+                    }
+                    else
+                    if (_bulk._tscr.empty()) break ;
+
+        /*----------------------------- merge cavity lists */
+                    push_list(_nold, _bulk._nold) ;
+                    push_list(_told, _bulk._told) ;
+                    push_list(_eprv, _bulk._eprv) ;
+                    push_list(_edat, _bulk._edat) ;
+                    push_list(_escr, _bulk._escr) ;
+                    push_list(_tdat, _bulk._tdat) ;
+                    push_list(_tscr, _bulk._tscr) ;
+                    push_list(_bdat, _bulk._bdat) ;
+                    push_list(_bscr, _bulk._bscr) ;
+                }
+                }
+
     #           ifdef  __use_timers
                 _ttoc = _time.now() ;           
                 _tcpu._tria_rule += 
@@ -1142,8 +1249,10 @@
         /*----------------------------- meshing converged */
             else { _done = true ;  }
     
-            if (_pass%_jlog_freq==+0 || _done)
+            if (_ilog >= _jlog_freq || _done)
             {
+                _ilog  = +0 ;
+                
         /*----------------------------- output to logfile */
                 std::stringstream _sstr;
                 _sstr << std::setw(+11) <<
@@ -1171,18 +1280,11 @@
 
             }
             
-            if (_pass%_trim_freq == +0 )
+            if (_itrm >= _trim_freq )
             {
-        /*--------------- trim null PQ items "on-the-fly" */
-              //trim_nbpq( _mesh , 
-              //           _nbpq ) ;
-                trim_eepq( _mesh , 
-                           _eepq ) ;
-                trim_ttpq( _mesh , 
-                           _ttpq ) ;
-              //trim_etpq( _mesh , 
-              //           _etpq ) ;
-              
+                _itrm  = +0 ;
+                
+        /*--------------- trim workspace lists "on-the-fly" */
                 trim_list( _nnew ) ;
                 trim_list( _nold ) ;
                 trim_list( _tnew ) ;
@@ -1249,7 +1351,7 @@
             {
                 _ttpq .push( *_iter ) ;
             }
-            
+
             for (auto _iter  = _bdat.head() ;
                       _iter != _bdat.tend() ; 
                     ++_iter  )
@@ -1268,6 +1370,16 @@
             {
                 _mesh.push_tria( *_iter) ;
             }
+
+        /*--------------- trim null PQ items, amortised */
+            trim_heap(_nbpq, 
+                ball_dead(&_mesh), _nblim) ;
+            trim_heap(_eepq, 
+                edge_dead(&_mesh), _eelim) ;
+            trim_heap(_ttpq, 
+                tria_dead(&_mesh), _ttlim) ;
+            trim_heap(_etpq, 
+                node_dead(&_mesh, &_emrk), _etlim) ;
               
         }
 
@@ -1355,6 +1467,8 @@
              _tnod[rdel_opts::sink_kind])) ;
         _dump.push("\n")  ;
         
+        _tcpu.pred_dump(_dump) ;
+        
         }
         
         _dump.push("\n")  ;
@@ -109,6 +109,7 @@
         bool_type           _top2 ; // impose "2-manifold-ness"
 
         iptr_type           _iter ; // max. no. refinement iter.
+        iptr_type           _bulk ; // max. no. trias per iter.
  
         public  :
             
@@ -177,7 +178,8 @@
             _top1(bool_type(false)) ,
             _top2(bool_type(false)) ,
      
-            _iter(init_iter())              
+            _iter(init_iter())  ,
+            _bulk(iptr_type(+   1))
         {   // load default values
         }
     
@@ -191,6 +193,10 @@
             )
         {   return  this->_iter ;
         }
+        __inline_call iptr_type      & bulk (
+            )
+        {   return  this->_bulk ;
+        }
         
         __inline_call iptr_type      & seed (
             )
@@ -298,6 +304,10 @@
             ) const
         {   return  this->_iter ;
         }
+        __inline_call iptr_type const& bulk (
+            ) const
+        {   return  this->_bulk ;
+        }
         
         __inline_call iptr_type const& seed (
             ) const
@@ -407,7 +417,7 @@
     typename R , 
     typename I
              >
-    class rdel_timers
+    class rdel_timers : public geompred::pred_stats
         {
         public  :
         
@@ -524,9 +524,6 @@
     "#------------------------------------------------------------\n"
             ) ;
           
-    /*------------------------------ ensure deterministic */  
-        std::srand( +1 ) ;
-           
     /*------------------------------ init. list workspace */
         iptr_list _nnew, _nold ;
         iptr_list _NNEW, _NOLD ;
@@ -252,7 +252,7 @@
                 } ;
         
             double _sign; 
-            _sign = geompred::insphere  (
+            _sign = geompred::inspherefilt  (
                 &_ipos[ 0] ,
                 &_jpos[ 0] ,
                 &_kpos[ 0] ,
@@ -135,20 +135,11 @@
     typedef typename 
             tria_pred::face_same            face_same ;
 
-    iptr_type static constexpr pool_byte_size = 96*1024 ;
-
-    typedef allocators::_pool_alloc <
-            allocators::basic_alloc ,
-                pool_byte_size      >       pool_base ;
-
-    typedef allocators::_wrap_alloc <
-                pool_base           >       pool_wrap ;
-
-    typedef containers::hash_table  <
+    typedef containers::hash_flat   <
                 face_ptrs ,
                 face_hash ,
                 face_same ,
-                pool_wrap           >       hash_list ;
+                allocator           >       hash_list ;
 
     typedef containers::block_array <
                 node_type , 
@@ -164,8 +155,6 @@
 
     public  :
     
-    pool_base                     _fpol ;
-
     hash_list                     _fset ;
 
     node_list                     _nset ;
@@ -175,6 +164,8 @@
     iptr_list                     _fnod ;
 
     iptr_list                     _work ;
+    
+    algorithms::rand_gen          _rand ;
 
     public  :
 
@@ -402,18 +393,16 @@
     
     __inline_call  delaunay_tri_k   (
         allocator const& _asrc = allocator ()
-        ) : _fpol(sizeof(
-      typename hash_list::item_type)) ,
-
-            _fset(face_hash(), 
+        ) : _fset(face_hash(), 
                   face_same(), 
-            +.9, (pool_wrap(&_fpol))) ,
+            +.9,   _asrc ) ,
 
             _nset( _asrc),
             _tset( _asrc),
             _ftri( _asrc),
             _fnod( _asrc), 
-            _work( _asrc)
+            _work( _asrc),
+            _rand(   +1 )
     {   tria_pred::exactinit() ;    // init. predicates
     }
     
@@ -431,6 +420,8 @@
     /*---------------------------- de-alloc. existing */
         this->_nset.clear() ;
         this->_tset.clear() ;
+        
+        this->_rand.seed(+1);
 
     /*---------------------------- scale initial tria */
         real_type static constexpr _scal = 
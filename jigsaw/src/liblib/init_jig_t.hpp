@@ -77,12 +77,15 @@
         _jcfg->_hfun_scal = JIGSAW_HFUN_RELATIVE ;
         _jcfg->_hfun_hmax = (real_t) +0.02 ;
         _jcfg->_hfun_hmin = (real_t) +0.00 ;
+        _jcfg->_hfun_dhdx = (real_t) 
+            std::numeric_limits<real_t>::infinity();
         
     /*------------------------------------- MESH keywords */
         _jcfg->_mesh_kern = JIGSAW_KERN_DELFRONT ;
         _jcfg->_mesh_dims = (indx_t) +3 ;
         _jcfg->_mesh_iter = (indx_t) 
             std::numeric_limits<iptr_type>::max();
+        _jcfg->_mesh_bulk = (indx_t) +1 ;
         
         _jcfg->_mesh_top1 = (indx_t) +0 ;
         _jcfg->_mesh_top2 = (indx_t) +0 ;
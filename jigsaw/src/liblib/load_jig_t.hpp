@@ -134,6 +134,13 @@
             this->
            _jjig->_hfun_hmin = _hmin; 
         }
+        __normal_call void_type push_hfun_dhdx (
+            double        _dhdx
+            ) 
+        {
+            this->
+           _jjig->_hfun_dhdx = _dhdx; 
+        }
     
     /*------------------------------------- KERN keywords */
         __normal_call void_type push_bnds_kern (
@@ -167,6 +174,13 @@
             this->
            _jjig->_mesh_iter = _iter;
         }
+        __normal_call void_type push_mesh_bulk (
+            std::int32_t  _bulk
+            ) 
+        { 
+            this->
+           _jjig->_mesh_bulk = _bulk;
+        }
         __normal_call void_type push_mesh_siz1 (
             double        _siz1
             ) 
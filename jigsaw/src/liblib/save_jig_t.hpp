@@ -112,6 +112,8 @@
                     _jcfg->_hfun_hmax << "\n" ;
                 _file << "HFUN_HMAX = " << 
                     _jcfg->_hfun_hmin << "\n" ;
+                _file << "HFUN_DHDX = " << 
+                    _jcfg->_hfun_dhdx << "\n" ;
         
         /*--------------------------------- BNDS keywords */
                 if (_jcfg->_bnds_kern == 
@@ -141,6 +143,8 @@
                 
                 _file << "MESH_ITER = " << 
                     _jcfg->_mesh_iter << "\n" ;
+                _file << "MESH_BULK = " << 
+                    _jcfg->_mesh_bulk << "\n" ;
             
                 _file << "MESH_SIZ1 = " << 
                     _jcfg->_mesh_siz1 << "\n" ;
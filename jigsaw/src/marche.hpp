@@ -159,6 +159,81 @@
 #           endif//__use_timers
         }
      
+        if (_fmsh != nullptr )
+        {
+    /*--------------------------------- parse *.HFUN data */
+            _jlog.push (  __jloglndv    "\n" ) ;
+            _jlog.push (
+                "  Reading HFUN data...\n\n" ) ;
+        
+#           ifdef  __use_timers
+            _ttic   = _time.now();
+#           endif//__use_timers
+
+            if ((_retv = copy_hfun (
+                 _jcfg, _jlog , 
+                 _ffun,*_fmsh)) != __no_error)
+            {
+                return  _retv ;
+            }
+            
+            if ((_retv = test_hfun (
+                 _jcfg, 
+                 _jlog, _ffun)) != __no_error)
+            {
+                return  _retv ;
+            }
+
+            if ((_retv = test_clip (
+                 _jcfg, 
+                 _jlog, _ffun)) != __no_error)
+            {
+                return  _retv ;
+            }
+            
+#           ifdef  __use_timers             
+            _ttoc   = _time.now();
+            _jlog.push(dump_time(_ttic, _ttoc));
+#           endif//__use_timers
+    
+    /*--------------------------------- limit |dh/dx| */
+            _jlog.push (  __jloglndv    "\n" ) ;
+            _jlog.push (
+                "  Limiting HFUN data...\n\n" ) ;
+        
+#           ifdef  __use_timers
+            _ttic   = _time.now();
+#           endif//__use_timers
+        
+            _ffun.clip_hfun (_jcfg) ;
+            
+#           ifdef  __use_timers
+            _ttoc   = _time.now();
+            _jlog.push(dump_time(_ttic, _ttoc));
+#           endif//__use_timers
+    
+    /*--------------------------------- dump *.HFUN data */
+            _jlog.push (  __jloglndv    "\n" ) ;
+            _jlog.push (
+                "  Writing HFUN data...\n\n" ) ;
+        
+#           ifdef  __use_timers
+            _ttic   = _time.now();
+#           endif//__use_timers
+
+            if ((_retv = save_msht (
+                 _jcfg, _jlog , 
+                 _ffun,*_fmsh)) != __no_error)
+            {
+                return  _retv ;
+            }
+            
+#           ifdef  __use_timers
+            _ttoc   = _time.now();
+            _jlog.push(dump_time(_ttic, _ttoc));
+#           endif//__use_timers
+        }
+     
     /*-------------------------- success, if we got here! */
 
         return ( _retv ) ;
@@ -260,6 +335,81 @@
                 return  _retv ;
             }
             
+#           ifdef  __use_timers
+            _ttoc   = _time.now();
+            _jlog.push(dump_time(_ttic, _ttoc));
+#           endif//__use_timers
+        }
+        
+        if(!_jcfg._hfun_file.empty())
+        {
+    /*--------------------------------- parse *.HFUN file */
+            _jlog.push (  __jloglndv    "\n" ) ;
+            _jlog.push (
+                "  Reading HFUN file...\n\n" ) ;
+        
+#           ifdef  __use_timers
+            _ttic   = _time.now();
+#           endif//__use_timers
+
+            if ((_retv = read_hfun (
+                 _jcfg, 
+                 _jlog, _ffun)) != __no_error)
+            {
+                return  _retv ;
+            }
+            
+            if ((_retv = test_hfun (
+                 _jcfg, 
+                 _jlog, _ffun)) != __no_error)
+            {
+                return  _retv ;
+            }
+
+            if ((_retv = test_clip (
+                 _jcfg, 
+                 _jlog, _ffun)) != __no_error)
+            {
+                return  _retv ;
+            }
+             
+#           ifdef  __use_timers
+            _ttoc   = _time.now();
+            _jlog.push(dump_time(_ttic, _ttoc));
+#           endif//__use_timers
+    
+    /*--------------------------------- limit |dh/dx| */
+            _jlog.push (  __jloglndv    "\n" ) ;
+            _jlog.push (
+                "  Limiting HFUN data...\n\n" ) ;
+        
+#           ifdef  __use_timers
+            _ttic   = _time.now();
+#           endif//__use_timers
+        
+            _ffun.clip_hfun (_jcfg) ;
+            
+#           ifdef  __use_timers
+            _ttoc   = _time.now();
+            _jlog.push(dump_time(_ttic, _ttoc));
+#           endif//__use_timers
+    
+    /*--------------------------------- dump *.HFUN file */
+            _jlog.push (  __jloglndv    "\n" ) ;
+            _jlog.push (
+                "  Writing HFUN file...\n\n" ) ;
+        
+#           ifdef  __use_timers
+            _ttic   = _time.now();
+#           endif//__use_timers
+
+            if ((_retv = save_hfun (
+                 _jcfg, 
+                 _jlog, _ffun)) != __no_error)
+            {
+                return  _retv ;
+            }
+            
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
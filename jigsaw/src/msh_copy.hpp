@@ -81,24 +81,21 @@
         _mesh._ndim = _rdel._ndim ;
         
         _mesh._euclidean_mesh_2d._mesh.
-            _map1._lptr.set_count (
+            _map1.set_slots (
            (_rdel._euclidean_rdel_2d.
-            _tria._nset.count()*5)/4, 
-        containers::loose_alloc, nullptr);
+            _tria._nset.count()*5)/4) ;
                 
         _mesh._euclidean_mesh_2d._mesh.
-            _map2._lptr.set_count (
+            _map2.set_slots (
            (_rdel._euclidean_rdel_2d.
             _eset.count()*5) / 4 +
            (_rdel._euclidean_rdel_2d.
-            _tset.count()*7) / 3 , 
-        containers::loose_alloc, nullptr);
+            _tset.count()*7) / 3 ) ;
         
         _mesh._euclidean_mesh_2d._mesh.
-            _map3._lptr.set_count (
+            _map3.set_slots (
            (_rdel._euclidean_rdel_2d.
-            _tset.count()*5) / 4 , 
-        containers::loose_alloc, nullptr);
+            _tset.count()*5) / 4 ) ;
         
         
         for (auto _iter  = _rdel.
@@ -201,34 +198,30 @@
         _mesh._ndim = _rdel._ndim ;
         
         _mesh._euclidean_mesh_3d._mesh.
-            _map1._lptr.set_count (
+            _map1.set_slots (
            (_rdel._euclidean_rdel_3d.
-            _tria._nset.count()*5)/4, 
-        containers::loose_alloc, nullptr);
+            _tria._nset.count()*5)/4) ;
         
         _mesh._euclidean_mesh_3d._mesh.
-            _map2._lptr.set_count (
+            _map2.set_slots (
            (_rdel._euclidean_rdel_3d.
             _eset.count()*5) / 4 +
            (_rdel._euclidean_rdel_3d.
             _fset.count()*7) / 3 +
            (_rdel._euclidean_rdel_3d.
-            _tset.count()*9) / 2 , 
-        containers::loose_alloc, nullptr);
+            _tset.count()*9) / 2 ) ;
         
         _mesh._euclidean_mesh_3d._mesh.
-            _map3._lptr.set_count (
+            _map3.set_slots (
            (_rdel._euclidean_rdel_3d.
             _fset.count()*5) / 4 +
            (_rdel._euclidean_rdel_3d.
-            _tset.count()*8) / 3 , 
-        containers::loose_alloc, nullptr);
+            _tset.count()*8) / 3 ) ;
         
         _mesh._euclidean_mesh_3d._mesh.
-            _map4._lptr.set_count (
+            _map4.set_slots (
            (_rdel._euclidean_rdel_3d.
-            _tset.count()*5) / 4 , 
-        containers::loose_alloc, nullptr);
+            _tset.count()*5) / 4 ) ;
         
         
         for (auto _iter  = _rdel.
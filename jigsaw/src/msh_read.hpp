@@ -180,6 +180,42 @@
         
     jmsh_kind::enum_data    _kind ;
     
+    bool_type               _fbin ;
+    
+    std:: size_t static 
+        constexpr _VMAX = +16 ;
+
+    std:: size_t static 
+        constexpr bulk_size = +65536 ;
+    
+    struct sect_kind {
+        enum enum_data {
+            null_sect           = +0 ,
+            point_sect ,
+            power_sect ,
+            coord_sect ,
+            value_sect ,
+            edge2_sect ,
+            tria3_sect ,
+            quad4_sect ,
+            tria4_sect ,
+            hexa8_sect ,
+            wedg6_sect ,
+            pyra5_sect ,
+            bound_sect
+        } ;
+        } ;
+    
+    class sect_data
+        {
+        public  :
+        sect_kind::enum_data  _kind ;
+        std:: size_t          _nrow ;
+        std:: size_t          _ncol ;
+        std:: size_t          _nreal;
+        std:: size_t          _nindx;
+        } ;
+    
     public  :
 
     /*
@@ -192,12 +228,20 @@
         typename  dest_type
              >
     __normal_call void_type read_mshid (
-        std::ifstream &_ffid,
         string_tokens &_stok,
         dest_type     &_dest
         )
     {
-        __unreferenced (_ffid) ;
+        this->_fbin = false ;
+    
+        if (_stok.count() >= +3 &&
+            _stok[_stok.count()-1] == "BINARY")
+        {
+    /*----------------------------------- binary rows, v3 */
+            this->_fbin = true ;
+            
+            _stok._pop_tail() ;
+        }
     
         if (_stok.count() == +2)
         {
@@ -278,13 +322,10 @@
         typename  dest_type
              >
     __normal_call void_type read_ndims (
-        std::ifstream &_ffid,
         string_tokens &_stok,
         dest_type     &_dest
         )
     {
-        __unreferenced (_ffid) ;
-    
         if (_stok.count() == +2)
         {
             this->
@@ -310,13 +351,10 @@
         typename  dest_type
              >
     __normal_call void_type read_radii (
-        std::ifstream &_ffid,
         string_tokens &_stok,
         dest_type     &_dest
         )
     {
-        __unreferenced (_ffid) ;
-        
         double _erad[ +3] ;
         if (_stok.count() == +4)
         {
@@ -338,919 +376,649 @@
 
     /*
     --------------------------------------------------------
-     * READ-POINT: read POINT data section
+     * FIND-SECT: parse head of a data section
+    --------------------------------------------------------
+     *
+     * Maps section heads (POINT=n, COORD=i;n, etc) onto a 
+     * row layout: the no. of reals, followed by the no. of
+     * indices per row. Returns FALSE (w/out error) if the
+     * head is not a known data section.
+     *
     --------------------------------------------------------
      */
     
-    template <
-        typename  dest_type
-             >
-    __normal_call void_type read_point (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
+    __normal_call bool_type find_sect (
+        string_tokens &_stok,
+        sect_data     &_sect
         )
     {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +2)
+        _sect._kind = sect_kind::null_sect ;
+        _sect._nrow = +0 ;
+        _sect._ncol = +0 ;
+        _sect._nreal= +0 ;
+        _sect._nindx= +0 ;
+    
+        std::string const&_name = _stok[0] ;
+        
+        std:: size_t _ntok = +2 ;
+        
+        if (_name == "POINT")
         {
-            _nrow = std::stol(_stok[1]);
+            _sect._kind = sect_kind::point_sect ;
+            _sect._nreal= this->_ndim ;
+            _sect._nindx= +1 ;
         }
         else
+        if (_name == "POWER")
         {
-            this->_errs.
-            push_tail("Invalid POINT!");
+            _sect._kind = sect_kind::power_sect ;
+            _ntok = +3 ;
         }
-        
-        _dest.open_point(_nrow);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
+        else
+        if (_name == "COORD")
         {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_tstr.count() == this->_ndim+1)
-            {
-                std:: size_t static 
-                    constexpr _VMAX = +16;
-            
-                double _pval[_VMAX];
-                std::int32_t _itag ;
-                for (auto _ipos = this->_ndim ;
-                          _ipos-- != +0; )
-                {
-                    _pval[_ipos] = 
-                     std::stod(_tstr[_ipos]);
-                }
-                
-                _itag = std::stol(
-                    _tstr[this->_ndim]);
-                
-                _dest.push_point (
-                   _irow, _pval, _itag);
-            }
-            else
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            }
-            catch (...)
-            {
-                this->_errs.push_tail(_line);
-            }
-    
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
-    }
-    
-    /*
-    --------------------------------------------------------
-     * READ-POWER: read POWER data section
-    --------------------------------------------------------
-     */
-    
-    template <
-        typename  dest_type
-             >
-    __normal_call void_type read_power (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
-        )
-    {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _npwr = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +3)
+            _sect._kind = sect_kind::coord_sect ;
+            _sect._nreal= +1 ;
+            _ntok = +3 ;
+        }
+        else
+        if (_name == "VALUE")
         {
-            _nrow = std::stol(_stok[1]);
-            _npwr = std::stol(_stok[2]);
+            _sect._kind = sect_kind::value_sect ;
+            _ntok = +3 ;
         }
         else
+        if (_name == "EDGE2")
         {
-            this->_errs.
-            push_tail("Invalid POWER!");
+            _sect._kind = sect_kind::edge2_sect ;
+            _sect._nindx= +3 ;
         }
-        
-        _dest.open_power(_nrow , _npwr);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
+        else
+        if (_name == "TRIA3")
         {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_npwr == _tstr.count ())
-            {
-                std:: size_t static 
-                    constexpr _VMAX = +16;
-            
-                double _vpwr[_VMAX];
-                for (auto _ipos = _npwr;
-                          _ipos-- != +0; )
-                {
-                    _vpwr[_ipos] = 
-                     std::stod(_tstr[_ipos]);
-                }
-                
-                _dest.
-                 push_power(_irow, _vpwr);
-            }
-            else
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            }
-            catch (...)
-            {
-                this->_errs.push_tail(_line);
-            }
-    
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
-    }
-    
-    /*
-    --------------------------------------------------------
-     * READ-COORD: read COORD data section
-    --------------------------------------------------------
-     */
-    
-    template <
-        typename  dest_type
-             >
-    __normal_call void_type read_coord (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
-        )
-    {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _idim = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +3)
+            _sect._kind = sect_kind::tria3_sect ;
+            _sect._nindx= +4 ;
+        }
+        else
+        if (_name == "QUAD4")
         {
-            _idim = std::stol(_stok[1]);
-            _nrow = std::stol(_stok[2]);
+            _sect._kind = sect_kind::quad4_sect ;
+            _sect._nindx= +5 ;
         }
         else
+        if (_name == "TRIA4")
         {
-            this->_errs.
-            push_tail("Invalid COORD!");
+            _sect._kind = sect_kind::tria4_sect ;
+            _sect._nindx= +5 ;
         }
-        
-        _dest.open_coord(_idim, _nrow) ;
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
+        else
+        if (_name == "HEXA8")
         {
-            try
-            {
-                _dest.push_coord ( _idim ,
-                    _irow, std::stod(_line));
-            }
-            catch (...)
-            {
-                this->_errs.push_tail(_line);
-            }
-    
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
-    }
-
-    /*
-    --------------------------------------------------------
-     * READ-VALUE: read VALUE data section
-    --------------------------------------------------------
-     */
-    
-    template <
-        typename  dest_type
-             >
-    __normal_call void_type read_value (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
-        )
-    {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _nval = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +3)
+            _sect._kind = sect_kind::hexa8_sect ;
+            _sect._nindx= +9 ;
+        }
+        else
+        if (_name == "WEDG6")
         {
-            _nrow = std::stol(_stok[1]);
-            _nval = std::stol(_stok[2]);
+            _sect._kind = sect_kind::wedg6_sect ;
+            _sect._nindx= +7 ;
         }
         else
+        if (_name == "PYRA5")
         {
-            this->_errs.
-            push_tail("Invalid VALUE!");
+            _sect._kind = sect_kind::pyra5_sect ;
+            _sect._nindx= +6 ;
+        }
+        else
+        if (_name == "BOUND")
+        {
+            _sect._kind = sect_kind::bound_sect ;
+            _sect._nindx= +3 ;
+        }
+        else
+        {
+            return ( false ) ;
         }
         
-        _dest.open_value(_nrow, _nval) ;
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
+    /*----------------------------------------- read head */
+        if (_stok.count() == _ntok)
         {
-            try
+            if (_sect._kind == 
+                sect_kind::coord_sect)
             {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_nval == _tstr.count ())
-            {
-                std:: size_t static 
-                    constexpr _VMAX = +16;
-            
-                double _vval[_VMAX];
-                for (auto _ipos = _nval;
-                          _ipos-- != +0; )
-                {
-                    _vval[_ipos] = 
-                     std::stod(_tstr[_ipos]);
-                }
-                
-                _dest.
-                 push_value(_irow, _vval);
+            _sect._ncol = std::stol(_stok[1]);
+            _sect._nrow = std::stol(_stok[2]);
             }
             else
+            if (_ntok == +3)
             {
-                this->_errs.push_tail(_line);
+            _sect._nrow = std::stol(_stok[1]);
+            _sect._ncol = std::stol(_stok[2]);
+            _sect._nreal= _sect._ncol ;
             }
-            
-            }
-            catch (...)
+            else
             {
-                this->_errs.push_tail(_line);
+            _sect._nrow = std::stol(_stok[1]);
             }
-            
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
-    }
-
-    /*
-    --------------------------------------------------------
-     * READ-EDGE2: read EDGE2 data section
-    --------------------------------------------------------
-     */
-
-    template <
-        typename  dest_type
-             >
-    __normal_call void_type read_edge2 (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
-        )
-    {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +2)
-        {
-            _nrow = std::stol(_stok[1]);
         }
         else
         {
-            this->_errs.
-            push_tail("Invalid EDGE2!");
+            _sect._kind = sect_kind::null_sect ;
         }
         
-        _dest.open_edge2(_nrow);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
+        if (_sect._nreal + _sect._nindx == +0 ||
+            _sect._nreal > _VMAX ||
+            _sect._nindx > _VMAX )
         {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_tstr.count() == +3)
-            {
-                std::int32_t _node[2], _itag;
-                _node[0] =
-                    std::stol(_tstr[0]);
-                _node[1] =
-                    std::stol(_tstr[1]);
-                
-                _itag    =
-                    std::stol(_tstr[2]);
-                
-                _dest.push_edge2 (
-                   _irow, _node, _itag);
-            }
-            else
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            }
-            catch (...)
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
+            _sect._kind = sect_kind::null_sect ;
+        }
+        
+        if (_sect._kind == sect_kind::null_sect)
+        {
+            this->_errs.push_tail(
+                "Invalid " + _name + "!") ;
+        }
+        
+        return ( true ) ;
     }
     
     /*
     --------------------------------------------------------
-     * READ-TRIA3: read TRIA3 data section
+     * OPEN-SECT: alloc. dest. for a data section
     --------------------------------------------------------
      */
-    
+     
     template <
         typename  dest_type
              >
-    __normal_call void_type read_tria3 (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
+    __normal_call void_type open_sect (
+        sect_data const&_sect,
+        dest_type      &_dest
         )
     {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +2)
+        switch (_sect._kind)
         {
-            _nrow = std::stol(_stok[1]);
+        case sect_kind::point_sect: 
+            _dest.open_point(_sect._nrow) ;
+            break ;
+        case sect_kind::power_sect: 
+            _dest.open_power(
+                _sect._nrow, _sect._ncol) ;
+            break ;
+        case sect_kind::coord_sect: 
+            _dest.open_coord(
+                _sect._ncol, _sect._nrow) ;
+            break ;
+        case sect_kind::value_sect: 
+            _dest.open_value(
+                _sect._nrow, _sect._ncol) ;
+            break ;
+        case sect_kind::edge2_sect: 
+            _dest.open_edge2(_sect._nrow) ;
+            break ;
+        case sect_kind::tria3_sect: 
+            _dest.open_tria3(_sect._nrow) ;
+            break ;
+        case sect_kind::quad4_sect: 
+            _dest.open_quad4(_sect._nrow) ;
+            break ;
+        case sect_kind::tria4_sect: 
+            _dest.open_tria4(_sect._nrow) ;
+            break ;
+        case sect_kind::hexa8_sect: 
+            _dest.open_hexa8(_sect._nrow) ;
+            break ;
+        case sect_kind::wedg6_sect: 
+            _dest.open_wedg6(_sect._nrow) ;
+            break ;
+        case sect_kind::pyra5_sect: 
+            _dest.open_pyra5(_sect._nrow) ;
+            break ;
+        case sect_kind::bound_sect: 
+            _dest.open_bound(_sect._nrow) ;
+            break ;
+        default : break ;
         }
-        else
-        {
-            this->_errs.
-            push_tail("Invalid TRIA3!");
-        }
-        
-        _dest.open_tria3(_nrow);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
-        {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_tstr.count() == +4)
-            {
-                std::int32_t _node[3], _itag;
-                _node[0] =
-                    std::stol(_tstr[0]);
-                _node[1] =
-                    std::stol(_tstr[1]);
-                _node[2] =
-                    std::stol(_tstr[2]);
-                
-                _itag    =
-                    std::stol(_tstr[3]);
-                
-                _dest.push_tria3 (
-                   _irow, _node, _itag);
-            }
-            else
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            }
-            catch (...)
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
     }
     
     /*
     --------------------------------------------------------
-     * READ-QUAD4: read QUAD4 data section
+     * PUSH-SECT: push one row of a data section
     --------------------------------------------------------
      */
-    
+     
     template <
         typename  dest_type
              >
-    __normal_call void_type read_quad4 (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
+    __normal_call void_type push_sect (
+        sect_data const&_sect,
+        std:: size_t    _irow,
+        double         *_rval,
+        std::int32_t   *_ival,
+        dest_type      &_dest
         )
     {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +2)
-        {
-            _nrow = std::stol(_stok[1]);
-        }
-        else
+        std::int32_t _itag = 
+            _sect._nindx > +0 ? 
+                _ival[_sect._nindx-1] : +0 ;
+    
+        switch (_sect._kind)
         {
-            this->_errs.
-            push_tail("Invalid QUAD4!");
+        case sect_kind::point_sect: 
+            _dest.push_point(
+                _irow, _rval, _itag) ;
+            break ;
+        case sect_kind::power_sect: 
+            _dest.push_power(_irow, _rval) ;
+            break ;
+        case sect_kind::coord_sect: 
+            _dest.push_coord(_sect._ncol , 
+                _irow, _rval[0]) ;
+            break ;
+        case sect_kind::value_sect: 
+            _dest.push_value(_irow, _rval) ;
+            break ;
+        case sect_kind::edge2_sect: 
+            _dest.push_edge2(
+                _irow, _ival, _itag) ;
+            break ;
+        case sect_kind::tria3_sect: 
+            _dest.push_tria3(
+                _irow, _ival, _itag) ;
+            break ;
+        case sect_kind::quad4_sect: 
+            _dest.push_quad4(
+                _irow, _ival, _itag) ;
+            break ;
+        case sect_kind::tria4_sect: 
+            _dest.push_tria4(
+                _irow, _ival, _itag) ;
+            break ;
+        case sect_kind::hexa8_sect: 
+            _dest.push_hexa8(
+                _irow, _ival, _itag) ;
+            break ;
+        case sect_kind::wedg6_sect: 
+            _dest.push_wedg6(
+                _irow, _ival, _itag) ;
+            break ;
+        case sect_kind::pyra5_sect: 
+            _dest.push_pyra5(
+                _irow, _ival, _itag) ;
+            break ;
+        case sect_kind::bound_sect: 
+            _dest.push_bound(_irow, 
+            _ival[0], _ival[1], _ival[2]) ;
+            break ;
+        default : break ;
         }
-        
-        _dest.open_quad4(_nrow);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
-        {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_tstr.count() == +5)
-            {
-                std::int32_t _node[4], _itag;
-                _node[0] =
-                    std::stol(_tstr[0]);
-                _node[1] =
-                    std::stol(_tstr[1]);
-                _node[2] =
-                    std::stol(_tstr[2]);
-                _node[3] =
-                    std::stol(_tstr[3]);
-                
-                _itag    =
-                    std::stol(_tstr[4]);
-                
-                _dest.push_quad4 (
-                   _irow, _node, _itag);
-            }
-            else
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            }
-            catch (...)
-            {
-                this->_errs.push_tail(_line);
-            }
- 
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
     }
     
     /*
     --------------------------------------------------------
-     * READ-TRIA4: read TRIA4 data section
+     * SCAN-ROW: parse one ;-delimited row, in-place
     --------------------------------------------------------
      */
     
-    template <
-        typename  dest_type
-             >
-    __normal_call void_type read_tria4 (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
+    __normal_call bool_type scan_row (
+        char const    *_head,
+        char const    *_tend,
+        sect_data const&_sect,
+        double        *_rval,
+        std::int32_t  *_ival
         )
     {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +2)
-        {
-            _nrow = std::stol(_stok[1]);
-        }
-        else
-        {
-            this->_errs.
-            push_tail("Invalid TRIA4!");
-        }
-        
-        _dest.open_tria4(_nrow);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
+        std:: size_t _nall = 
+            _sect._nreal + _sect._nindx ;
+    
+        for (std::size_t _ipos = +0; 
+                  _ipos != _nall; ++_ipos)
         {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_tstr.count() == +5)
+            char const *_tpos = (char const *)
+                std::memchr(_head, ';', _tend-_head) ;
+
+            if (_tpos == nullptr) 
             {
-                std::int32_t _node[4], _itag;
-                _node[0] =
-                    std::stol(_tstr[0]);
-                _node[1] =
-                    std::stol(_tstr[1]);
-                _node[2] =
-                    std::stol(_tstr[2]);
-                _node[3] =
-                    std::stol(_tstr[3]);
-                
-                _itag    =
-                    std::stol(_tstr[4]);
-                
-                _dest.push_tria4 (
-                   _irow, _node, _itag);
+            if (_ipos+1 != _nall) return false ;
+            
+                _tpos = _tend ;
             }
             else
             {
-                this->_errs.push_tail(_line);
+            if (_ipos+1 == _nall) return false ;
             }
             
+    /*----------------------------------- trim each token */
+            char const *_tok0 = _head ;
+            char const *_tok1 = _tpos ;
+            for ( ; _tok0 != _tok1 && 
+                   (*_tok0 == ' ' || 
+                    *_tok0 =='\t'); ++_tok0) ;
+            for ( ; _tok1 != _tok0 && 
+                   (_tok1[-1] == ' ' || 
+                    _tok1[-1] =='\t' ||
+                    _tok1[-1] =='\r'); --_tok1) ;
+            
+            if (_ipos < _sect._nreal)
+            {
+            if (!scan_real(_tok0, _tok1, 
+                    _rval[_ipos])) return false ;
             }
-            catch (...)
+            else
             {
-                this->_errs.push_tail(_line);
+            if (!scan_indx(_tok0, _tok1, _ival[
+                _ipos-_sect._nreal])) return false ;
             }
             
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
+            _head = _tpos + 1 ;
+        }
+        
+        return (  true ) ;
     }
     
+#   ifdef  __use_openmp
+
     /*
     --------------------------------------------------------
-     * READ-HEXA8: read HEXA8 data section
+     * READ-LINES-OMP: read ASCII data section in ||
+    --------------------------------------------------------
+     *
+     * As per READ-LINES, but in batches of rows: line 
+     * breaks are found in serial (via memchr), rows are 
+     * parsed in ||, and results pushed in serial again, 
+     * so that the dest. sees rows in order, as per the
+     * serial pass.
+     *
     --------------------------------------------------------
      */
-    
+     
     template <
         typename  dest_type
              >
-    __normal_call void_type read_hexa8 (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
+    __normal_call void_type read_lines_omp (
+        char const   *&_bptr,
+        char const    *_bend,
+        sect_data const&_sect,
+        dest_type     &_dest
         )
     {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +2)
-        {
-            _nrow = std::stol(_stok[1]);
-        }
-        else
-        {
-            this->_errs.
-            push_tail("Invalid HEXA8!");
-        }
+        open_sect(_sect, _dest) ;
+    
+        containers::array<char const*> _line ;
+        containers::array<double>      _rbuf ;
+        containers::array<std::int32_t>_ibuf ;
+        containers::array<char>        _okay ;
         
-        _dest.open_hexa8(_nrow);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
+        std:: size_t _nmax = std::min(
+            _sect._nrow, (std::size_t)bulk_size) ;
+        
+        _line.set_count(_nmax + 1) ;
+        _okay.set_count(_nmax + 0) ;
+        _rbuf.set_count(_nmax * _sect._nreal + 1) ;
+        _ibuf.set_count(_nmax * _sect._nindx + 1) ;
+    
+        for (std::size_t _irow = +0; 
+                _irow != _sect._nrow && 
+                _bptr != _bend ; )
         {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_tstr.count() == +9)
+    /*----------------------------- find next set of rows */
+            std:: size_t _nrow = +0 ;
+            for ( ; _nrow != _nmax && 
+                    _irow + _nrow != _sect._nrow &&
+                    _bptr != _bend ; ++_nrow)
             {
-                std::int32_t _node[8], _itag;
-                _node[0] =
-                    std::stol(_tstr[0]);
-                _node[1] =
-                    std::stol(_tstr[1]);
-                _node[2] =
-                    std::stol(_tstr[2]);
-                _node[3] =
-                    std::stol(_tstr[3]);
-                _node[4] =
-                    std::stol(_tstr[4]);
-                _node[5] =
-                    std::stol(_tstr[5]);
-                _node[6] =
-                    std::stol(_tstr[6]);
-                _node[7] =
-                    std::stol(_tstr[7]);
-                
-                _itag    =
-                    std::stol(_tstr[8]);
+                _line[_nrow] = _bptr ;
+            
+                char const *_lend = (char const *)
+                std::memchr(_bptr, '\n', _bend-_bptr) ;
                 
-                _dest.push_hexa8 (
-                   _irow, _node, _itag);
+                _bptr = _lend == nullptr ? 
+                        _bend : _lend + 1 ;
             }
-            else
+            
+            _line[_nrow] = _bptr ;
+            
+    /*----------------------------- parse rows in || */
+            long _last = (long)_nrow ;
+            
+            #pragma omp parallel for schedule(static)
+            for (long _ipos = +0; 
+                    _ipos < _last; ++_ipos)
             {
-                this->_errs.push_tail(_line);
-            }
+                char const *_lend = 
+                    _line[_ipos + 1] ;
+                
+                if (_lend != _line[_ipos] &&
+                    _lend[-1] == '\n') _lend -= +1 ;
             
+                _okay[_ipos] = scan_row (
+                    _line[_ipos], _lend, _sect, 
+                   &_rbuf[_ipos * _sect._nreal],
+                   &_ibuf[_ipos * _sect._nindx]) ;
             }
-            catch (...)
+            
+    /*----------------------------- push rows in serial */
+            for (std::size_t _ipos = +0; 
+                _ipos != _nrow; ++_ipos, ++_irow)
             {
-                this->_errs.push_tail(_line);
+                if (_okay[_ipos])
+                {
+                    push_sect(_sect, _irow, 
+                   &_rbuf[_ipos * _sect._nreal],
+                   &_ibuf[_ipos * _sect._nindx], 
+                    _dest) ;
+                }
+                else
+                {
+                    char const *_lend = 
+                        _line[_ipos + 1] ;
+                
+                    if (_lend != _line[_ipos] &&
+                        _lend[-1] == '\n') 
+                        _lend -= +1 ;
+                
+                    this->_errs.push_tail(
+                    std::string(_line[_ipos], _lend));
+                }
             }
-            
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
+        }
     }
 
+#   endif//__use_openmp
+
     /*
     --------------------------------------------------------
-     * READ-WEDG6: read WEDG6 data section
+     * READ-LINES: read ASCII data section
+    --------------------------------------------------------
+     *
+     * Rows are parsed in-place from the file's bytes: one
+     * row per line, as ;-delimited values. Nothing is
+     * allocated or thrown unless a row is ill-formed.
+     *
     --------------------------------------------------------
      */
-    
+     
     template <
         typename  dest_type
              >
-    __normal_call void_type read_wedg6 (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
+    __normal_call void_type read_lines (
+        char const   *&_bptr,
+        char const    *_bend,
+        sect_data const&_sect,
+        dest_type     &_dest
         )
     {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +2)
-        {
-            _nrow = std::stol(_stok[1]);
-        }
-        else
+#       ifdef  __use_openmp
+        if (omp_get_max_threads() > +1 &&
+            _sect._nrow >= bulk_size)
         {
-            this->_errs.
-            push_tail("Invalid WEDG6!");
+    /*---------------- parse big sections in || batches */
+            read_lines_omp(
+                _bptr, _bend, _sect, _dest) ;
+                
+            return ;
         }
-        
-        _dest.open_wedg6(_nrow);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
+#       endif//__use_openmp
+
+        open_sect(_sect, _dest) ;
+    
+        double       _rval[_VMAX] ;
+        std::int32_t _ival[_VMAX] ;
+    
+        for (std::size_t _irow = +0; 
+                _irow != _sect._nrow && 
+                _bptr != _bend ; ++_irow)
         {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_tstr.count() == +7)
+            char const *_lend = (char const *)
+                std::memchr(_bptr, '\n', _bend-_bptr) ;
+
+            if (_lend == nullptr) _lend = _bend ;
+            
+            if (scan_row(_bptr, _lend, 
+                    _sect, _rval, _ival) )
             {
-                std::int32_t _node[6], _itag;
-                _node[0] =
-                    std::stol(_tstr[0]);
-                _node[1] =
-                    std::stol(_tstr[1]);
-                _node[2] =
-                    std::stol(_tstr[2]);
-                _node[3] =
-                    std::stol(_tstr[3]);
-                _node[4] =
-                    std::stol(_tstr[4]);
-                _node[5] =
-                    std::stol(_tstr[5]);
-                
-                _itag    =
-                    std::stol(_tstr[6]);
-                
-                _dest.push_wedg6 (
-                   _irow, _node, _itag);
+                push_sect(_sect, 
+                    _irow, _rval, _ival, _dest) ;
             }
             else
             {
-                this->_errs.push_tail(_line);
+                this->_errs.push_tail(
+                    std::string(_bptr, _lend)) ;
             }
             
-            }
-            catch (...)
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
+            _bptr = _lend == _bend ? 
+                    _bend : _lend + 1 ;
+        }
     }
     
     /*
     --------------------------------------------------------
-     * READ-PYRA5: read PYRA5 data section
+     * READ-BLOCK: read BINARY data section
+    --------------------------------------------------------
+     *
+     * Each row is stored as raw little-endian values: the
+     * reals (float64) first, then the indices (int32), with
+     * the row padded to 8-byte multiples if any reals are
+     * present. This is the layout of the jigsaw_VERT2_t,
+     * jigsaw_TRIA3_t, etc structs in lib_jigsaw.
+     *
     --------------------------------------------------------
      */
-    
+     
     template <
         typename  dest_type
              >
-    __normal_call void_type read_pyra5 (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
+    __normal_call void_type read_block (
+        char const   *&_bptr,
+        char const    *_bend,
+        sect_data const&_sect,
+        dest_type     &_dest
         )
     {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +2)
-        {
-            _nrow = std::stol(_stok[1]);
-        }
-        else
-        {
-            this->_errs.
-            push_tail("Invalid PYRA5!");
-        }
+        std:: size_t _rlen = 
+            _sect._nreal * sizeof(double) +
+            _sect._nindx * sizeof(std::int32_t) ;
+            
+        if (_sect._nreal > +0)
+        _rlen = (_rlen + 7) / 8 * 8 ;
         
-        _dest.open_pyra5(_nrow);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
+        if ((std::size_t)(_bend - _bptr) 
+                / _rlen < _sect._nrow )
         {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
+    /*---------------------------- can't resync: give up */
+            this->_errs.push_tail(
+                "Invalid BINARY data!") ;
                 
-            find_toks (_line, ";", _tstr);
+            _bptr = _bend ; return ;
+        }
+        
+        open_sect(_sect, _dest) ;
        
-            if (_tstr.count() == +6)
-            {
-                std::int32_t _node[5], _itag;
-                _node[0] =
-                    std::stol(_tstr[0]);
-                _node[1] =
-                    std::stol(_tstr[1]);
-                _node[2] =
-                    std::stol(_tstr[2]);
-                _node[3] =
-                    std::stol(_tstr[3]);
-                _node[4] =
-                    std::stol(_tstr[4]);
-                
-                _itag    =
-                    std::stol(_tstr[5]);
-                
-                _dest.push_pyra5 (
-                   _irow, _node, _itag);
-            }
-            else
+        double       _rval[_VMAX] ;
+        std::int32_t _ival[_VMAX] ;
+        
+        for (std::size_t _irow = +0; 
+                  _irow != _sect._nrow; 
+                ++_irow, _bptr += _rlen)
+        {
+            char const *_rptr = _bptr ;
+            for (std::size_t _ipos = +0; 
+                _ipos != _sect._nreal; ++_ipos)
             {
-                this->_errs.push_tail(_line);
+                _rval[_ipos] = 
+                    load_bytes<double>(_rptr) ;
+                _rptr += sizeof(double) ;
             }
-            
-            }
-            catch (...)
+            for (std::size_t _ipos = +0; 
+                _ipos != _sect._nindx; ++_ipos)
             {
-                this->_errs.push_tail(_line);
+                _ival[_ipos] = 
+                    load_bytes<std::int32_t>(_rptr) ;
+                _rptr += sizeof(std::int32_t) ;
             }
             
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
+            push_sect(_sect, 
+                _irow, _rval, _ival, _dest) ;
         }        
     }
-    
+
     /*
     --------------------------------------------------------
-     * READ-BOUND: read BOUND data section
+     * NEXT-LINE: read one line of text from memory.
     --------------------------------------------------------
      */
-    
-    template <
-        typename  dest_type
-             >
-    __normal_call void_type read_bound (
-        std::ifstream&_ffid ,
-        string_tokens&_stok ,
-        dest_type    &_dest
+     
+    __normal_call std::string next_line (
+        char const   *&_bptr,
+        char const    *_bend
         )
     {
-    /*----------------------------------------- read head */
-        std:: size_t _nrow = +0;
-        std:: size_t _irow = +0;
-        if (_stok.count() == +2)
-        {
-            _nrow = std::stol(_stok[1]);
-        }
-        else
-        {
-            this->_errs.
-            push_tail("Invalid BOUND!");
-        }
+        char const *_lend = (char const *)
+            std::memchr(_bptr, '\n', _bend-_bptr) ;
+    
+        if (_lend == nullptr) _lend = _bend ;
         
-        _dest.open_bound(_nrow);
-   
-    /*----------------------------------------- read data */
-        std::string _line;
-        while (std::getline(_ffid, _line))
-        {
-            try
-            {
-            containers::
-                array<std::string> _tstr ;
-                
-            find_toks (_line, ";", _tstr);
-       
-            if (_tstr.count() == +3)
-            {
-                std::int32_t _itag =
-                    std::stol(_tstr[0]);
-                
-                std::int32_t _inum =
-                    std::stol(_tstr[1]);
-                
-                std::int32_t _kind =
-                    std::stol(_tstr[2]);
-                
-                _dest.push_bound (
-                _irow, _itag , _inum, _kind);
-            }
-            else
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            }
-            catch (...)
-            {
-                this->_errs.push_tail(_line);
-            }
-            
-            _irow += +1 ;
-            
-            if (--_nrow == +0) break ;
-        }        
+        std::string _line(_bptr, _lend) ;
+        
+        _bptr = _lend == _bend ? 
+                _bend : _lend + 1 ;
+        
+        return  _line ;
     }
 
     /*
     --------------------------------------------------------
-     * READ-FILE: read *.MSH file into MESH
+     * READ-DATA: read *.MSH file from memory
+    --------------------------------------------------------
+     *
+     * Section heads are ASCII lines, with rows following
+     * as ;-delimited text (see READ-LINES) or, given an 
+     * "MSHID=3;EUCLIDEAN-MESH;BINARY" style head, as raw 
+     * blocks of row data (see READ-BLOCK). Writers pad
+     * heads in BINARY files such that row data starts
+     * 8-byte aligned w.r.t. the file offset, so that a
+     * mapped file is also an aligned one.
+     *
     --------------------------------------------------------
      */
 
     template <
         typename  dest_type
              >
-    __normal_call void_type read_file (
-        std::ifstream&_ffid ,
-        dest_type   &&_dest
+    __normal_call void_type read_data (
+        char const    *_bptr,
+        char const    *_bend,
+        dest_type     &_dest
         )
     {
         this->_ftag = -1 ;
         this->_ndim = +0 ;
+        this->_fbin = false ;
     
-        std::string _line;
-        while (std::getline(_ffid, _line))
+        while (_bptr != _bend)
         {
-            _line = trim(_line) ;
+            std::string _line = 
+                trim(next_line(_bptr, _bend)) ;
             
             if (_line.size() <= 0) continue ;
             if (_line[ +0] == '#') continue ;
@@ -1273,94 +1041,51 @@
         /*---------------------------- trim on each token */
             *_iter = trim( *_iter ) ;
             
+            sect_data _sect ;
+            
             if (_stok[0] == "MSHID")
                 {
-                read_mshid(_ffid, _stok,
-                           _dest) ;
+                read_mshid(_stok, _dest) ;
                 }
             else
             if (_stok[0] == "NDIMS")
                 {
-                read_ndims(_ffid, _stok,
-                           _dest) ;
+                read_ndims(_stok, _dest) ;
                 }
             else
             if (_stok[0] == "RADII")
                 {
-                read_radii(_ffid, _stok,
-                           _dest) ;
-                }
-            else
-            if (_stok[0] == "POINT")
-                {
-                read_point(_ffid, _stok, 
-                           _dest) ; 
-                }
-            else
-            if (_stok[0] == "POWER")
-                {
-                read_power(_ffid, _stok, 
-                           _dest) ; 
-                }
-            else
-            if (_stok[0] == "COORD")
-                {
-                read_coord(_ffid, _stok, 
-                           _dest) ; 
-                }
-            else
-            if (_stok[0] == "VALUE")
-                {
-                read_value(_ffid, _stok, 
-                           _dest) ; 
-                }
-            else
-            if (_stok[0] == "EDGE2")
-                {
-                read_edge2(_ffid, _stok, 
-                           _dest) ;
+                read_radii(_stok, _dest) ;
                 }
             else
-            if (_stok[0] == "TRIA3")
+            if (find_sect(_stok, _sect))
                 {
-                read_tria3(_ffid, _stok, 
-                           _dest) ;
-                }
-            else
-            if (_stok[0] == "QUAD4")
+                if (_sect._kind == 
+                        sect_kind::null_sect)
                 {
-                read_quad4(_ffid, _stok, 
-                           _dest) ;
+            /*---------------- BINARY data can't be skipped */
+                    if (this->_fbin) break ;
                 }
-            else
-            if (_stok[0] == "TRIA4")
+                else
+                if (this->_fbin)
                 {
-                read_tria4(_ffid, _stok, 
-                           _dest) ;
+                read_block(_bptr, _bend, 
+                           _sect, _dest) ;
                 }
-            else
-            if (_stok[0] == "HEXA8")
+                else
                 {
-                read_hexa8(_ffid, _stok, 
-                           _dest) ;
+                read_lines(_bptr, _bend, 
+                           _sect, _dest) ;
                 }
-            else
-            if (_stok[0] == "WEDG6")
-                {
-                read_wedg6(_ffid, _stok, 
-                           _dest) ;
                 }
             else
-            if (_stok[0] == "PYRA5")
+            if (this->_fbin)
                 {
-                read_pyra5(_ffid, _stok, 
-                           _dest) ;
-                }
-            else
-            if (_stok[0] == "BOUND")
-                {
-                read_bound(_ffid, _stok, 
-                           _dest) ;
+            /*---------------- BINARY data can't be skipped */
+                this->
+               _errs.push_tail (_line) ;
+                
+                break ;
                 }
                           
             }
@@ -1371,6 +1096,34 @@
             }        
         }
     }
+
+    /*
+    --------------------------------------------------------
+     * READ-FILE: read *.MSH file into MESH
+    --------------------------------------------------------
+     *
+     * The file is mapped into memory and parsed in-place.
+     * Returns FALSE if the file can't be opened.
+     *
+    --------------------------------------------------------
+     */
+
+    template <
+        typename  dest_type
+             >
+    __normal_call bool_type read_file (
+        std::string const&_fstr ,
+        dest_type       &&_dest
+        )
+    {
+        file_view _fmap ;
+        if (!_fmap.open(_fstr)) return false ;
+        
+        read_data(_fmap._head, 
+            _fmap._head + _fmap._size, _dest) ;
+        
+        return  true ;
+    }
     
     } ;
 
@@ -46,6 +46,329 @@
 #   ifndef __MSH_SAVE__
 #   define __MSH_SAVE__
 
+    /*
+    --------------------------------------------------------
+     * JMSH-WRITER: write *.MSH data, ASCII or BINARY.
+    --------------------------------------------------------
+     *
+     * Files with a *.MSHB extension are written as version
+     * 3 binary containers (see READ-FBIN in msh_read.hpp),
+     * all others as ";"-delimited ASCII text.
+     *
+    --------------------------------------------------------
+     */
+
+    class jmsh_writer
+    {
+    public  :
+    
+    typedef std::initializer_list <
+            double       > real_list ;
+    typedef std::initializer_list <
+            std::int32_t > indx_list ;
+            
+    std:: size_t static 
+        constexpr _VMAX = +16 ;
+        
+    std:: size_t static 
+        constexpr _BMAX = +1024 * 1024 ;
+        
+    std:: size_t static 
+        constexpr _RMAX = _VMAX * +32 ;
+
+    std::ofstream           _file ;
+    
+    bool_type               _fbin ;
+    
+    containers::array<char> _fbuf ;
+    
+    std:: size_t            _fpos ;
+    std:: size_t            _fall ;
+    
+    public  :
+    
+    __normal_call jmsh_writer (
+        ) : _fbin(false), 
+            _fpos(+0), _fall(+0) {}
+        
+    __normal_call~jmsh_writer (
+        )
+    {
+        if (is_open()) close() ;
+    }
+    
+    /*------------------------------- open file for save */
+    
+    __normal_call bool_type open (
+        std::string const&_fstr
+        )
+    {
+        std::string _path ;
+        std::string _name ;
+        std::string _fext ; 
+        file_part(
+            _fstr, _path, _name, _fext) ;
+            
+        std::transform(_fext.begin() , 
+                       _fext.  end() , 
+                       _fext.begin() , 
+                     ::tolower) ;
+                     
+        this->_fbin = _fext == "mshb" ;
+        
+        if (this->_fbin)
+        this->_file.open(_fstr , 
+            std::ofstream::out | 
+            std::ofstream::binary ) ;
+        else
+        this->_file.open(_fstr , 
+            std::ofstream::out ) ;
+            
+        this->_fbuf.set_count(_BMAX) ;
+        this->_fpos = +0 ;
+        this->_fall = +0 ;
+        
+        return this->_file.is_open() ;
+    }
+    
+    __inline_call bool_type is_open (
+        ) const
+    {
+        return this->_file.is_open() ;
+    }
+    
+    __normal_call void_type close (
+        )
+    {
+        flush() ;
+        
+        this->_file.close() ;
+    }
+    
+    /*------------------------------- write output block */
+    
+    __normal_call void_type flush (
+        )
+    {
+        this->_file.write(
+            &this->_fbuf[0], this->_fpos) ;
+            
+        this->_fall += this->_fpos ;
+        this->_fpos  = +0 ;
+    }
+    
+    __inline_call char * make_room (
+        std:: size_t      _size
+        )
+    {
+        if (this->_fpos + _size > _BMAX) 
+            flush() ;
+    
+        return &this->_fbuf[this->_fpos] ;
+    }
+    
+    __normal_call void_type push_text (
+        std::string const&_text
+        )
+    {
+        if (_text.size() > _BMAX)
+        {
+            flush() ;
+            this->_file << _text ;
+            this->_fall += _text.size() ;
+        }
+        else
+        {
+            char *_bptr = 
+                make_room(_text.size()) ;
+            
+            std::memcpy(_bptr, 
+                _text.data(), _text.size()) ;
+                
+            this->_fpos += _text.size() ;
+        }
+    }
+    
+    /*------------------------------- write file headers */
+    
+    __normal_call void_type push_head (
+        std::string const&_name ,
+        char const       *_mshid,
+        std:: size_t      _ndim
+        )
+    {
+        std::string _line = 
+            "# " + _name + ".msh" + 
+            "; created by " __JGSWVSTR "\n" ;
+        
+        _line += _mshid ;
+        
+        if (this->_fbin) 
+        _line += ";BINARY" ;
+        
+        _line += " \n" ;
+        _line += "NDIMS=" + 
+            std::to_string(_ndim) + " \n" ;
+            
+        push_text(_line) ;
+    }
+    
+    __normal_call void_type push_radii (
+        double _radA ,
+        double _radB ,
+        double _radC
+        )
+    {
+        char *_head = make_room(_RMAX) ;
+        char *_tend = _head ;
+        
+        std::memcpy(_tend, "RADII=", 6) ;
+        _tend += 6 ;
+        _tend  = print_real(_tend, _radA) ;
+       *_tend++ = ';' ;
+        _tend  = print_real(_tend, _radB) ;
+       *_tend++ = ';' ;
+        _tend  = print_real(_tend, _radC) ;
+       *_tend++ ='\n' ;
+       
+        this->_fpos += _tend - _head ;
+    }
+    
+    /*------------------------------- write section head */
+    
+    __normal_call void_type push_sect (
+        char const       *_kind ,
+        std:: size_t      _num1
+        )
+    {
+        push_sect(_kind, 
+            std::to_string(_num1)) ;
+    }
+    
+    __normal_call void_type push_sect (
+        char const       *_kind ,
+        std:: size_t      _num1 ,
+        std:: size_t      _num2
+        )
+    {
+        push_sect(_kind, 
+            std::to_string(_num1) + ";" + 
+            std::to_string(_num2)) ;
+    }
+    
+    __normal_call void_type push_sect (
+        char const       *_kind ,
+        std::string const&_nums
+        )
+    {
+        std::string _line = 
+            std::string(_kind) + "=" + _nums ;
+        
+        if (this->_fbin)
+        {
+    /*------------------------------- pad so rows aligned */
+            std:: size_t _fend = 
+                this->_fall + this->_fpos +
+                    _line.size() + 1 ;
+                    
+            _line.append(
+               (8 - _fend % 8) % 8, ' ') ;
+        }
+    
+        push_text(_line + "\n") ;
+    }
+    
+    /*------------------------------- write one data row */
+    
+    __normal_call void_type push_row (
+        double       const*_rval ,
+        std:: size_t       _nreal,
+        std::int32_t const*_ival ,
+        std:: size_t       _nindx
+        )
+    {
+        char *_head = make_room(_RMAX) ;
+        char *_tend = _head ;
+    
+        if (this->_fbin)
+        {
+    /*------------------------------- raw, padded binary */
+            for (std::size_t _ipos = +0; 
+                      _ipos != _nreal; ++_ipos)
+            {
+                pack_bytes(_tend, _rval[_ipos]) ;
+                _tend += sizeof(double) ;
+            }
+            for (std::size_t _ipos = +0; 
+                      _ipos != _nindx; ++_ipos)
+            {
+                pack_bytes(_tend, _ival[_ipos]) ;
+                _tend += sizeof(std::int32_t) ;
+            }
+            
+            if (_nreal > +0)
+            for ( ; (_tend-_head) % 8 != +0; ) 
+               *_tend++ = +0 ;
+        }
+        else
+        {
+    /*------------------------------- ";"-delimited text */
+            for (std::size_t _ipos = +0; 
+                      _ipos != _nreal; ++_ipos)
+            {
+                _tend = print_real(
+                    _tend, _rval[_ipos]) ;
+               *_tend++ = ';' ;
+            }
+            for (std::size_t _ipos = +0; 
+                      _ipos != _nindx; ++_ipos)
+            {
+                _tend = print_indx(
+                    _tend, _ival[_ipos]) ;
+               *_tend++ = ';' ;
+            }
+            
+            if (_tend != _head) _tend[-1] = '\n' ;
+        }
+        
+        this->_fpos += _tend - _head ;
+    }
+    
+    __inline_call void_type push_point (
+        real_list     _ppos ,
+        std::int32_t  _itag
+        )
+    {
+        push_row(_ppos.begin(), 
+            _ppos.size() , &_itag, +1) ;
+    }
+    
+    __inline_call void_type push_reals (
+        real_list     _rval
+        )
+    {
+        push_row(_rval.begin(), 
+            _rval.size() , nullptr, +0) ;
+    }
+    
+    __inline_call void_type push_cell (
+        indx_list     _node ,
+        std::int32_t  _itag
+        )
+    {
+        std::int32_t _ival[_VMAX] ;
+        
+        std::copy(_node.begin(), 
+                  _node.  end(), _ival) ;
+                  
+        _ival[_node.size()] = _itag ;
+        
+        push_row(nullptr, +0, 
+            _ival, _node.size() + 1) ;
+    }
+    
+    } ;
+
     /*
     --------------------------------------------------------
      * SAVE-JMSH: save *.JMSH output file.
@@ -69,7 +392,7 @@
         {
             containers::array<iptr_type> _nmap;
                 
-            std::ofstream _file ;
+            jmsh_writer   _file ;
 
             std::string _path ;
             std::string _name ;
@@ -79,8 +402,7 @@
                     _path, _name, _fext);
 
             _file.open(
-                _jcfg._mesh_file, 
-                    std::ofstream::out );
+                _jcfg._mesh_file) ;
                      
             if (_file.is_open())
             {
@@ -89,15 +411,8 @@
                 jmsh_kind::euclidean_mesh)
             {
             /*-------------------------- save 2-dim. mesh */
-                _file << "# " << _name << ".msh"
-                      << "; created by " ;
-                _file << __JGSWVSTR "\n" ;
-                _file << "MSHID=2;EUCLIDEAN-MESH \n" ;
-                _file << "NDIMS=2 \n" ;
-
-                _file << std::scientific ;
-                _file << 
-                    std::setprecision(16);
+                _file.push_head(_name, 
+                    "MSHID=2;EUCLIDEAN-MESH", +2) ;
 
             /*------------ index mapping for active nodes */
                 _nmap.set_count(_rdel.
@@ -154,7 +469,7 @@
                         _tria._nset.count() > 0)
                 {
             /*-------------------------- write POINT data */                
-                _file << "POINT=" << _last << "\n" ;
+                _file.push_sect("POINT", _last) ;
                 
                 iptr_type _npos  = +0 ;
                 
@@ -167,9 +482,9 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << _iter->pval(0) << ";"
-                          << _iter->pval(1) << ";"
-                          << +0 << "\n" ;
+                    _file.push_point({
+                        _iter->pval(0) ,
+                        _iter->pval(1) }, +0) ;
                     }
                 }
                 }
@@ -180,8 +495,7 @@
                         _tria._nset.count() > 0)
                 {
             /*-------------------------- write POWER data */   
-                _file << "POWER=" 
-                      << _last << ";1" << "\n" ;
+                _file.push_sect("POWER", _last, +1) ;
                 
                 iptr_type _npos  = +0 ;
                 
@@ -194,7 +508,7 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << (real_type)0. << "\n" ;
+                    _file.push_reals({(real_type)0.}) ;
                     }
                 }
                 }
@@ -204,9 +518,9 @@
                         _eset.count() > +0)
                 {
             /*-------------------------- write EDGE2 data */ 
-                _file << "EDGE2=" << 
+                _file.push_sect("EDGE2", 
                     _rdel._euclidean_rdel_2d.
-                        _eset.count() << "\n" ;
+                        _eset.count()) ;
                 
                 for (auto _iter  = _rdel.
                 _euclidean_rdel_2d._eset._lptr.head();
@@ -220,12 +534,10 @@
                         _item != nullptr;
                         _item  = _item->_next )
                     {
-                    _file << 
-                    _nmap[_item->_data._node[0]]
-                          << ";" << 
-                    _nmap[_item->_data._node[1]]
-                          << ";" << 
-                    _item->_data._part << "\n" ;             
+                    _file.push_cell ({
+                        _nmap[_item->_data._node[0]] ,
+                        _nmap[_item->_data._node[1]] }, 
+                        _item->_data._part) ;
                     }
                 }
                 }
@@ -234,9 +546,9 @@
                         _tset.count() > +0)
                 {
             /*-------------------------- write TRIA3 data */ 
-                _file << "TRIA3=" << 
+                _file.push_sect("TRIA3", 
                     _rdel._euclidean_rdel_2d.
-                        _tset.count() << "\n" ;
+                        _tset.count()) ;
                 
                 for (auto _iter  = _rdel.
                 _euclidean_rdel_2d._tset._lptr.head();
@@ -250,14 +562,11 @@
                         _item != nullptr;
                         _item  = _item->_next )
                     {
-                    _file << 
-                    _nmap[_item->_data._node[0]]
-                          << ";" << 
-                    _nmap[_item->_data._node[1]]
-                          << ";" << 
-                    _nmap[_item->_data._node[2]]
-                          << ";" << 
-                    _item->_data._part << "\n" ;
+                    _file.push_cell ({
+                        _nmap[_item->_data._node[0]] ,
+                        _nmap[_item->_data._node[1]] ,
+                        _nmap[_item->_data._node[2]] }, 
+                        _item->_data._part) ;
                     }
                 }
                 }
@@ -269,15 +578,8 @@
                 jmsh_kind::euclidean_mesh) 
             {
             /*-------------------------- save 3-dim. mesh */
-                _file << "# " << _name << ".msh"
-                      << "; created by " ;
-                _file << __JGSWVSTR "\n" ;
-                _file << "MSHID=2;EUCLIDEAN-MESH \n" ;
-                _file << "NDIMS=3 \n" ;
-                
-                _file << std::scientific ;
-                _file << 
-                    std::setprecision(16);
+                _file.push_head(_name, 
+                    "MSHID=2;EUCLIDEAN-MESH", +3) ;
                     
             /*------------ index mapping for active nodes */
                 _nmap.set_count(_rdel.
@@ -353,7 +655,7 @@
                         _tria._nset.count() > 0)
                 {
             /*-------------------------- write POINT data */                
-                _file << "POINT=" << _last << "\n" ;
+                _file.push_sect("POINT", _last) ;
                 
                 iptr_type _npos  = +0 ;
                 
@@ -366,10 +668,10 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << _iter->pval(0) << ";"
-                          << _iter->pval(1) << ";"
-                          << _iter->pval(2) << ";"
-                          << +0 << "\n" ;
+                    _file.push_point({
+                        _iter->pval(0) ,
+                        _iter->pval(1) ,
+                        _iter->pval(2) }, +0) ;
                     }
                 }
                 }
@@ -380,8 +682,7 @@
                         _tria._nset.count() > 0)
                 {
             /*-------------------------- write POWER data */                
-                _file << "POWER=" 
-                      << _last << ";1" << "\n" ;
+                _file.push_sect("POWER", _last, +1) ;
                 
                 iptr_type _npos  = +0 ;
                 
@@ -394,7 +695,7 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << (real_type)0. << "\n" ;
+                    _file.push_reals({(real_type)0.}) ;
                     }
                 }
                 }
@@ -404,9 +705,9 @@
                         _eset.count() > +0)
                 {
             /*-------------------------- write EDGE2 data */ 
-                _file << "EDGE2=" << 
+                _file.push_sect("EDGE2", 
                     _rdel._euclidean_rdel_3d.
-                        _eset.count() << "\n" ;
+                        _eset.count()) ;
                         
                 for (auto _iter  = _rdel.
                 _euclidean_rdel_3d._eset._lptr.head();
@@ -420,12 +721,10 @@
                         _item != nullptr;
                         _item  = _item->_next )
                     {
-                    _file << 
-                    _nmap[_item->_data._node[0]]
-                          << ";" << 
-                    _nmap[_item->_data._node[1]]
-                          << ";" << 
-                    _item->_data._part << "\n" ;
+                    _file.push_cell ({
+                        _nmap[_item->_data._node[0]] ,
+                        _nmap[_item->_data._node[1]] }, 
+                        _item->_data._part) ;
                     }
                 }
                 }
@@ -434,9 +733,9 @@
                         _fset.count() > +0)
                 {
             /*-------------------------- write TRIA3 data */ 
-                _file << "TRIA3=" << 
+                _file.push_sect("TRIA3", 
                     _rdel._euclidean_rdel_3d.
-                        _fset.count() << "\n" ;
+                        _fset.count()) ;
                 
                 for (auto _iter  = _rdel.
                 _euclidean_rdel_3d._fset._lptr.head();
@@ -450,14 +749,11 @@
                         _item != nullptr;
                         _item  = _item->_next )
                     {
-                    _file << 
-                    _nmap[_item->_data._node[0]]
-                          << ";" << 
-                    _nmap[_item->_data._node[1]]
-                          << ";" << 
-                    _nmap[_item->_data._node[2]]
-                          << ";" << 
-                    _item->_data._part << "\n" ;
+                    _file.push_cell ({
+                        _nmap[_item->_data._node[0]] ,
+                        _nmap[_item->_data._node[1]] ,
+                        _nmap[_item->_data._node[2]] }, 
+                        _item->_data._part) ;
                     }
                 }
                 }
@@ -466,9 +762,9 @@
                         _tset.count() > +0)
                 {
             /*-------------------------- write TRIA4 data */ 
-                _file << "TRIA4=" << 
+                _file.push_sect("TRIA4", 
                     _rdel._euclidean_rdel_3d.
-                        _tset.count() << "\n" ;
+                        _tset.count()) ;
                 
                 for (auto _iter  = _rdel.
                 _euclidean_rdel_3d._tset._lptr.head();
@@ -482,16 +778,12 @@
                         _item != nullptr;
                         _item  = _item->_next )
                     {
-                    _file << 
-                    _nmap[_item->_data._node[0]]
-                          << ";" << 
-                    _nmap[_item->_data._node[1]]
-                          << ";" << 
-                    _nmap[_item->_data._node[2]]
-                          << ";" << 
-                    _nmap[_item->_data._node[3]]
-                          << ";" << 
-                    _item->_data._part << "\n" ;
+                    _file.push_cell ({
+                        _nmap[_item->_data._node[0]] ,
+                        _nmap[_item->_data._node[1]] ,
+                        _nmap[_item->_data._node[2]] ,
+                        _nmap[_item->_data._node[3]] }, 
+                        _item->_data._part) ;
                     }
                 }
                 }
@@ -538,7 +830,7 @@
         {
             containers::array<iptr_type> _nmap;
                 
-            std::ofstream _file ;
+            jmsh_writer   _file ;
 
             std::string _path ;
             std::string _name ;
@@ -548,8 +840,7 @@
                     _path, _name, _fext);
 
             _file.open(
-                _jcfg._tria_file, 
-                    std::ofstream::out );
+                _jcfg._tria_file) ;
                      
             if (_file.is_open())
             {
@@ -558,15 +849,8 @@
                 jmsh_kind::euclidean_mesh)
             {
             /*-------------------------- save 2-dim. mesh */
-                _file << "# " << _name << ".msh"
-                      << "; created by " ;
-                _file << __JGSWVSTR "\n" ;
-                _file << "MSHID=2;EUCLIDEAN-MESH \n" ;
-                _file << "NDIMS=2 \n" ;
-
-                _file << std::scientific ;
-                _file << 
-                    std::setprecision(16);
+                _file.push_head(_name, 
+                    "MSHID=2;EUCLIDEAN-MESH", +2) ;
 
             /*------------ index mapping for active nodes */
                 _nmap.set_count(_rdel.
@@ -604,7 +888,7 @@
                         _tria._nset.count() > 0)
                 {
             /*-------------------------- write POINT data */                
-                _file << "POINT=" << _last << "\n" ;
+                _file.push_sect("POINT", _last) ;
                 
                 iptr_type _npos  = +0 ;
                 for (auto _iter  = _rdel.
@@ -616,9 +900,9 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << _iter->pval(0) << ";"
-                          << _iter->pval(1) << ";"
-                          << +0 << "\n" ;
+                    _file.push_point({
+                        _iter->pval(0) ,
+                        _iter->pval(1) }, +0) ;
                     }
                 }
                 }
@@ -627,7 +911,7 @@
                         _tria._tset.count() > 0)
                 {
             /*-------------------------- write TRIA3 data */ 
-                _file << "TRIA3=" << _ntri << "\n" ;
+                _file.push_sect("TRIA3", _ntri) ;
                 
                 for (auto _iter  = _rdel.
                 _euclidean_rdel_2d._tria._tset.head();
@@ -637,11 +921,10 @@
                 {
                     if (_iter->mark() < +0) continue ;
                 
-                    _file << 
-                    _nmap[_iter->node(0)] << ";" << 
-                    _nmap[_iter->node(1)] << ";" <<
-                    _nmap[_iter->node(2)] << ";" <<
-                       +0 << "\n" ;
+                    _file.push_cell ({
+                        _nmap[_iter->node(0)] ,
+                        _nmap[_iter->node(1)] ,
+                        _nmap[_iter->node(2)] }, +0) ;
                 }
                 }
      
@@ -652,15 +935,8 @@
                 jmsh_kind::euclidean_mesh) 
             {
             /*-------------------------- save 3-dim. mesh */
-                _file << "# " << _name << ".msh"
-                      << "; created by " ;
-                _file << __JGSWVSTR "\n" ;
-                _file << "MSHID=2;EUCLIDEAN-MESH \n" ;
-                _file << "NDIMS=3 \n" ;
-                
-                _file << std::scientific ;
-                _file << 
-                    std::setprecision(16);
+                _file.push_head(_name, 
+                    "MSHID=2;EUCLIDEAN-MESH", +3) ;
                     
             /*------------ index mapping for active nodes */
                 _nmap.set_count(_rdel.
@@ -699,7 +975,7 @@
                         _tria._nset.count() > 0)
                 {
             /*-------------------------- write POINT data */                
-                _file << "POINT=" << _last << "\n" ;
+                _file.push_sect("POINT", _last) ;
                 
                 iptr_type _npos  = +0 ;
                 for (auto _iter  = _rdel.
@@ -711,10 +987,10 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << _iter->pval(0) << ";"
-                          << _iter->pval(1) << ";"
-                          << _iter->pval(2) << ";"
-                          << +0 << "\n" ;
+                    _file.push_point({
+                        _iter->pval(0) ,
+                        _iter->pval(1) ,
+                        _iter->pval(2) }, +0) ;
                     }
                 }
                 }
@@ -723,7 +999,7 @@
                         _tria._tset.count() > 0)
                 {
             /*-------------------------- write TRIA3 data */ 
-                _file << "TRIA4=" << _ntri << "\n" ;
+                _file.push_sect("TRIA4", _ntri) ;
                 
                 for (auto _iter  = _rdel.
                 _euclidean_rdel_3d._tria._tset.head();
@@ -733,12 +1009,11 @@
                 {
                     if (_iter->mark() < +0) continue ;
                 
-                    _file << 
-                    _nmap[_iter->node(0)] << ";" << 
-                    _nmap[_iter->node(1)] << ";" <<
-                    _nmap[_iter->node(2)] << ";" <<
-                    _nmap[_iter->node(3)] << ";" <<
-                       +0 << "\n" ;
+                    _file.push_cell ({
+                        _nmap[_iter->node(0)] ,
+                        _nmap[_iter->node(1)] ,
+                        _nmap[_iter->node(2)] ,
+                        _nmap[_iter->node(3)] }, +0) ;
                 }
                 }
                 
@@ -1221,7 +1496,7 @@
         {
             containers::array<iptr_type> _nmap;
                 
-            std::ofstream _file ;
+            jmsh_writer   _file ;
 
             std::string _path ;
             std::string _name ;
@@ -1231,8 +1506,7 @@
                     _path, _name, _fext);
 
             _file.open(
-                _jcfg._mesh_file, 
-                    std::ofstream::out );
+                _jcfg._mesh_file) ;
                      
             if (_file.is_open())
             {
@@ -1241,15 +1515,8 @@
                 jmsh_kind::euclidean_mesh)
             {
             /*-------------------------- save 2-dim. mesh */
-                _file << "# " << _name << ".msh"
-                      << "; created by " ;
-                _file << __JGSWVSTR "\n" ;
-                _file << "MSHID=3;EUCLIDEAN-MESH \n" ;
-                _file << "NDIMS=2 \n" ;
-
-                _file << std::scientific ;
-                _file << 
-                    std::setprecision(16);
+                _file.push_head(_name, 
+                    "MSHID=3;EUCLIDEAN-MESH", +2) ;
 
             /*------------ index mapping for active nodes */
                 _nmap.set_count(_mesh.
@@ -1304,7 +1571,7 @@
                 if (_nnum > +0)
                 {
             /*-------------------------- write POINT data */                
-                _file << "POINT=" << _nnum << "\n" ;
+                _file.push_sect("POINT", _nnum) ;
                 
                 iptr_type _npos  = +0;
                 
@@ -1317,9 +1584,9 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << _iter->pval(0) << ";"
-                          << _iter->pval(1) << ";"
-                          << +0 << "\n" ;
+                    _file.push_point({
+                        _iter->pval(0) ,
+                        _iter->pval(1) }, +0) ;
                     }
                 }
                 }
@@ -1329,8 +1596,7 @@
             /*-------------------------- write POWER data */                
                 if (_jcfg._iter_opts.dual() )
                 {
-                _file << "POWER=" 
-                      << _nnum << ";1" << "\n" ;
+                _file.push_sect("POWER", _nnum, +1) ;
                 
                 iptr_type _npos  = +0;
                 
@@ -1343,7 +1609,7 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << _iter->pval(2) << "\n" ;
+                    _file.push_reals({_iter->pval(2)}) ;
                     }
                 }
                 }
@@ -1352,7 +1618,7 @@
                 if (_enum > +0)
                 {
             /*-------------------------- write EDGE2 data */ 
-                _file << "EDGE2=" << _enum << "\n" ;
+                _file.push_sect("EDGE2", _enum) ;
                 
                 for (auto _iter  = _mesh.
                 _euclidean_mesh_2d._mesh._set2.head() ;
@@ -1363,12 +1629,10 @@
                     if (_iter->mark() >= 0 &&
                         _iter->self() >= 1 )
                     {
-                    _file << 
-                    _nmap[_iter->node(0)] << ";" 
-                          << 
-                    _nmap[_iter->node(1)] << ";"
-                          << 
-                    _iter->itag() << "\n"  ;
+                    _file.push_cell ({
+                        _nmap[_iter->node(0)] ,
+                        _nmap[_iter->node(1)] }, 
+                        _iter->itag()) ;
                     }
                 }
                 }
@@ -1376,7 +1640,7 @@
                 if (_tnum > +0)
                 {
             /*-------------------------- write TRIA3 data */ 
-                _file << "TRIA3=" << _tnum << "\n" ;
+                _file.push_sect("TRIA3", _tnum) ;
                 
                 for (auto _iter  = _mesh.
                 _euclidean_mesh_2d._mesh._set3.head() ;
@@ -1387,14 +1651,11 @@
                     if (_iter->mark() >= 0 &&
                         _iter->self() >= 1 )
                     {
-                    _file << 
-                    _nmap[_iter->node(0)] << ";" 
-                          << 
-                    _nmap[_iter->node(1)] << ";"
-                          << 
-                    _nmap[_iter->node(2)] << ";"
-                          << 
-                    _iter->itag() << "\n"  ;
+                    _file.push_cell ({
+                        _nmap[_iter->node(0)] ,
+                        _nmap[_iter->node(1)] ,
+                        _nmap[_iter->node(2)] }, 
+                        _iter->itag()) ;
                     }
                 }
                 }
@@ -1406,15 +1667,8 @@
                 jmsh_kind::euclidean_mesh)
             {
             /*-------------------------- save 3-dim. mesh */
-                _file << "# " << _name << ".msh" 
-                      << "; created by " ;
-                _file << __JGSWVSTR "\n" ;
-                _file << "MSHID=3;EUCLIDEAN-MESH \n" ;
-                _file << "NDIMS=3 \n" ;
-                
-                _file << std::scientific ;
-                _file << 
-                    std::setprecision(16);
+                _file.push_head(_name, 
+                    "MSHID=3;EUCLIDEAN-MESH", +3) ;
 
             /*------------ index mapping for active nodes */
                 _nmap.set_count(_mesh.
@@ -1487,7 +1741,7 @@
                 if (_nnum > +0)
                 {
             /*-------------------------- write POINT data */                
-                _file << "POINT=" << _nnum << "\n" ;
+                _file.push_sect("POINT", _nnum) ;
                 
                 iptr_type _npos  = +0;
                 
@@ -1500,10 +1754,10 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << _iter->pval(0) << ";"
-                          << _iter->pval(1) << ";"
-                          << _iter->pval(2) << ";"
-                          << +0 << "\n" ;
+                    _file.push_point({
+                        _iter->pval(0) ,
+                        _iter->pval(1) ,
+                        _iter->pval(2) }, +0) ;
                     }
                 }
                 }
@@ -1513,8 +1767,7 @@
             /*-------------------------- write POWER data */                
                 if (_jcfg._iter_opts.dual() )
                 {
-                _file << "POWER=" 
-                      << _nnum << ";1" << "\n" ;
+                _file.push_sect("POWER", _nnum, +1) ;
                 
                 iptr_type _npos  = +0;
                 
@@ -1527,7 +1780,7 @@
                     if (_iter->mark() >= 0 &&
                         _nmap[_npos ] >= 0)
                     {
-                    _file << _iter->pval(3) << "\n" ;
+                    _file.push_reals({_iter->pval(3)}) ;
                     }
                 }
                 }
@@ -1536,7 +1789,7 @@
                 if (_enum > +0)
                 {
             /*-------------------------- write EDGE2 data */ 
-                _file << "EDGE2=" << _enum << "\n" ;
+                _file.push_sect("EDGE2", _enum) ;
                 
                 for (auto _iter  = _mesh.
                 _euclidean_mesh_3d._mesh._set2.head() ;
@@ -1547,12 +1800,10 @@
                     if (_iter->mark() >= 0 &&
                         _iter->self() >= 1 )
                     {
-                    _file << 
-                    _nmap[_iter->node(0)] << ";" 
-                          << 
-                    _nmap[_iter->node(1)] << ";"
-                          << 
-                    _iter->itag() << "\n"  ;
+                    _file.push_cell ({
+                        _nmap[_iter->node(0)] ,
+                        _nmap[_iter->node(1)] }, 
+                        _iter->itag()) ;
                     }
                 }
                 }
@@ -1560,7 +1811,7 @@
                 if (_fnum > +0)
                 {
             /*-------------------------- write TRIA3 data */ 
-                _file << "TRIA3=" << _fnum << "\n" ;
+                _file.push_sect("TRIA3", _fnum) ;
                 
                 for (auto _iter  = _mesh.
                 _euclidean_mesh_3d._mesh._set3.head() ;
@@ -1571,14 +1822,11 @@
                     if (_iter->mark() >= 0 &&
                         _iter->self() >= 1 )
                     {
-                    _file << 
-                    _nmap[_iter->node(0)] << ";" 
-                          << 
-                    _nmap[_iter->node(1)] << ";"
-                          << 
-                    _nmap[_iter->node(2)] << ";"
-                          << 
-                    _iter->itag() << "\n"  ;
+                    _file.push_cell ({
+                        _nmap[_iter->node(0)] ,
+                        _nmap[_iter->node(1)] ,
+                        _nmap[_iter->node(2)] }, 
+                        _iter->itag()) ;
                     }
                 }
                 }
@@ -1586,7 +1834,7 @@
                 if (_tnum > +0)
                 {
             /*-------------------------- write TRIA3 data */ 
-                _file << "TRIA4=" << _tnum << "\n" ;
+                _file.push_sect("TRIA4", _tnum) ;
                 
                 for (auto _iter  = _mesh.
                 _euclidean_mesh_3d._mesh._set4.head() ;
@@ -1597,16 +1845,12 @@
                     if (_iter->mark() >= 0 &&
                         _iter->self() >= 1 )
                     {
-                    _file << 
-                    _nmap[_iter->node(0)] << ";" 
-                          << 
-                    _nmap[_iter->node(1)] << ";"
-                          << 
-                    _nmap[_iter->node(2)] << ";"
-                          << 
-                    _nmap[_iter->node(3)] << ";"
-                          << 
-                    _iter->itag() << "\n"  ;
+                    _file.push_cell ({
+                        _nmap[_iter->node(0)] ,
+                        _nmap[_iter->node(1)] ,
+                        _nmap[_iter->node(2)] ,
+                        _nmap[_iter->node(3)] }, 
+                        _iter->itag()) ;
                     }
                 }
                 }
@@ -2046,6 +2290,517 @@
         return ( _errv ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     * SAVE-HFUN: save *.JMSH output file.
+    --------------------------------------------------------
+     */
+     
+    template <
+    typename      jlog_data
+             >
+    __normal_call iptr_type save_hfun (
+        jcfg_data &_jcfg ,
+        jlog_data &_jlog ,
+        hfun_data &_hfun
+        )
+    {
+        iptr_type _errv  = __no_error  ;
+
+        __unreferenced(_jlog) ;
+
+        try
+        {
+            containers::array<iptr_type> _nmap;
+                
+            jmsh_writer   _file ;
+
+            std::string _path ;
+            std::string _name ;
+            std::string _fext ; 
+            file_part(
+                _jcfg._hfun_file, 
+                    _path, _name, _fext);
+
+            _file.open(
+                _jcfg._hfun_file) ;
+                     
+            if (_file.is_open())
+            {
+            if (_hfun._ndim == +2 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_mesh)
+            {
+            /*-------------------------- save 2-dim. mesh */
+                _file.push_head(_name, 
+                    "MSHID=3;EUCLIDEAN-MESH", +2) ;
+
+            /*------------ index mapping for active nodes */
+                _nmap.set_count(_hfun.
+                    _euclidean_mesh_2d._mesh._set1.count(), 
+                        containers::tight_alloc, -1) ;
+
+                iptr_type _last  = +0;
+                iptr_type _npos  = +0;
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_2d._mesh._set1.head();
+                          _iter != _hfun.
+                _euclidean_mesh_2d._mesh._set1.tend();
+                        ++_iter, ++_npos)
+                {
+                    if (_iter->mark() >= +0)
+                    {
+                        _nmap[_npos] = _last ++ ;
+                    }
+                }
+                
+                iptr_type _ntri  = +0;
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_2d._mesh._set3.head();
+                          _iter != _hfun.
+                _euclidean_mesh_2d._mesh._set3.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() >= +0)
+                    {
+                        _ntri += +1 ;
+                    }
+                }
+
+            /*-------------------------- write POINT data */                
+                _file.push_sect("POINT", _last) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_2d._mesh._set1.head();
+                          _iter != _hfun.
+                _euclidean_mesh_2d._mesh._set1.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() < +0) continue ;
+                    
+                    _file.push_point({
+                        _iter->pval(0) ,
+                        _iter->pval(1) }, +0) ;
+                }
+                
+            /*-------------------------- write TRIA3 data */ 
+                _file.push_sect("TRIA3", _ntri) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_2d._mesh._set3.head();
+                          _iter != _hfun.
+                _euclidean_mesh_2d._mesh._set3.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() < +0) continue ;
+                
+                    _file.push_cell ({
+                        _nmap[_iter->node(0)] ,
+                        _nmap[_iter->node(1)] ,
+                        _nmap[_iter->node(2)] }, +0) ;
+                }
+                
+            /*-------------------------- write VALUE data */
+                _file.push_sect("VALUE", _last, +1) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_2d._mesh._set1.head();
+                          _iter != _hfun.
+                _euclidean_mesh_2d._mesh._set1.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() < +0) continue ;
+                    
+                    _file.push_reals({_iter->hval()}) ;
+                }
+            }
+            else
+            if (_hfun._ndim == +3 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_mesh)
+            {
+            /*-------------------------- save 3-dim. mesh */
+                _file.push_head(_name, 
+                    "MSHID=3;EUCLIDEAN-MESH", +3) ;
+
+            /*------------ index mapping for active nodes */
+                _nmap.set_count(_hfun.
+                    _euclidean_mesh_3d._mesh._set1.count(), 
+                        containers::tight_alloc, -1) ;
+
+                iptr_type _last  = +0;
+                iptr_type _npos  = +0;
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_3d._mesh._set1.head();
+                          _iter != _hfun.
+                _euclidean_mesh_3d._mesh._set1.tend();
+                        ++_iter, ++_npos)
+                {
+                    if (_iter->mark() >= +0)
+                    {
+                        _nmap[_npos] = _last ++ ;
+                    }
+                }
+                
+                iptr_type _ntri  = +0;
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_3d._mesh._set4.head();
+                          _iter != _hfun.
+                _euclidean_mesh_3d._mesh._set4.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() >= +0)
+                    {
+                        _ntri += +1 ;
+                    }
+                }
+
+            /*-------------------------- write POINT data */                
+                _file.push_sect("POINT", _last) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_3d._mesh._set1.head();
+                          _iter != _hfun.
+                _euclidean_mesh_3d._mesh._set1.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() < +0) continue ;
+                    
+                    _file.push_point({
+                        _iter->pval(0) ,
+                        _iter->pval(1) ,
+                        _iter->pval(2) }, +0) ;
+                }
+                
+            /*-------------------------- write TRIA4 data */ 
+                _file.push_sect("TRIA4", _ntri) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_3d._mesh._set4.head();
+                          _iter != _hfun.
+                _euclidean_mesh_3d._mesh._set4.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() < +0) continue ;
+                
+                    _file.push_cell ({
+                        _nmap[_iter->node(0)] ,
+                        _nmap[_iter->node(1)] ,
+                        _nmap[_iter->node(2)] ,
+                        _nmap[_iter->node(3)] }, +0) ;
+                }
+                
+            /*-------------------------- write VALUE data */
+                _file.push_sect("VALUE", _last, +1) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_3d._mesh._set1.head();
+                          _iter != _hfun.
+                _euclidean_mesh_3d._mesh._set1.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() < +0) continue ;
+                    
+                    _file.push_reals({_iter->hval()}) ;
+                }
+            }
+            else
+            if (_hfun._ndim == +2 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_grid)
+            {
+            /*-------------------------- save 2-dim. grid */
+                _file.push_head(_name, 
+                    "MSHID=3;EUCLIDEAN-GRID", +2) ;
+
+            /*-------------------------- write COORD data */
+                _file.push_sect("COORD", +1, _hfun.
+                _euclidean_grid_2d._xpos.count()) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_grid_2d._xpos.head();
+                          _iter != _hfun.
+                _euclidean_grid_2d._xpos.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+                
+                _file.push_sect("COORD", +2, _hfun.
+                _euclidean_grid_2d._ypos.count()) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_grid_2d._ypos.head();
+                          _iter != _hfun.
+                _euclidean_grid_2d._ypos.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+                
+            /*-------------------------- write VALUE data */
+                _file.push_sect("VALUE", _hfun.
+                _euclidean_grid_2d._hmat.count(), +1) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_grid_2d._hmat.head();
+                          _iter != _hfun.
+                _euclidean_grid_2d._hmat.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+            }
+            else
+            if (_hfun._ndim == +3 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_grid)
+            {
+            /*-------------------------- save 3-dim. grid */
+                _file.push_head(_name, 
+                    "MSHID=3;EUCLIDEAN-GRID", +3) ;
+
+            /*-------------------------- write COORD data */
+                _file.push_sect("COORD", +1, _hfun.
+                _euclidean_grid_3d._xpos.count()) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_grid_3d._xpos.head();
+                          _iter != _hfun.
+                _euclidean_grid_3d._xpos.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+                
+                _file.push_sect("COORD", +2, _hfun.
+                _euclidean_grid_3d._ypos.count()) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_grid_3d._ypos.head();
+                          _iter != _hfun.
+                _euclidean_grid_3d._ypos.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+                
+                _file.push_sect("COORD", +3, _hfun.
+                _euclidean_grid_3d._zpos.count()) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_grid_3d._zpos.head();
+                          _iter != _hfun.
+                _euclidean_grid_3d._zpos.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+                
+            /*-------------------------- write VALUE data */
+                _file.push_sect("VALUE", _hfun.
+                _euclidean_grid_3d._hmat.count(), +1) ;
+                
+                for (auto _iter  = _hfun.
+                _euclidean_grid_3d._hmat.head();
+                          _iter != _hfun.
+                _euclidean_grid_3d._hmat.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+            }
+            else
+            if (_hfun._kind ==
+                jmsh_kind::ellipsoid_grid)
+            {
+            /*-------------------------- save ellipsoid-grid */
+                _file.push_head(_name, 
+                    "MSHID=3;ELLIPSOID-GRID", +2) ;
+                    
+                if (_hfun._ellipsoid_grid_3d.
+                        _radA > (real_type) +0.)
+                _file.push_radii(
+                    _hfun._ellipsoid_grid_3d._radA ,
+                    _hfun._ellipsoid_grid_3d._radB ,
+                    _hfun._ellipsoid_grid_3d._radC ) ;
+
+            /*-------------------------- write COORD data */
+                _file.push_sect("COORD", +1, _hfun.
+                _ellipsoid_grid_3d._xpos.count()) ;
+                
+                for (auto _iter  = _hfun.
+                _ellipsoid_grid_3d._xpos.head();
+                          _iter != _hfun.
+                _ellipsoid_grid_3d._xpos.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+                
+                _file.push_sect("COORD", +2, _hfun.
+                _ellipsoid_grid_3d._ypos.count()) ;
+                
+                for (auto _iter  = _hfun.
+                _ellipsoid_grid_3d._ypos.head();
+                          _iter != _hfun.
+                _ellipsoid_grid_3d._ypos.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+                
+            /*-------------------------- write VALUE data */
+                _file.push_sect("VALUE", _hfun.
+                _ellipsoid_grid_3d._hmat.count(), +1) ;
+                
+                for (auto _iter  = _hfun.
+                _ellipsoid_grid_3d._hmat.head();
+                          _iter != _hfun.
+                _ellipsoid_grid_3d._hmat.tend();
+                        ++_iter  )
+                {
+                    _file.push_reals({*_iter}) ;
+                }
+            }
+
+            }
+            else
+            {
+                _errv = __file_not_located ;
+            }
+            
+            _file.close();
+
+        }
+        catch (...)
+        {
+            _errv = __unknown_error ;
+        }
+
+        return ( _errv ) ;
+    }
+    
+    /*
+    --------------------------------------------------------
+     * SAVE-MSHT: save MSH_T output data.
+    --------------------------------------------------------
+     */
+
+    template <
+    typename      jlog_data
+             >
+    __normal_call iptr_type save_msht (
+        jcfg_data &_jcfg ,
+        jlog_data &_jlog ,
+        hfun_data &_hfun ,
+        jigsaw_msh_t &_hmsh
+        )
+    {
+        iptr_type _errv  = __no_error  ;
+
+        __unreferenced(_jcfg) ;
+        __unreferenced(_jlog) ;
+
+        try
+        {
+    /*------------ push HFUN values back in-place to MSH_T */
+            if (_hfun._ndim == +2 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_mesh)
+            {
+                std::size_t _ipos = +0 ;
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_2d._mesh._set1.head();
+                          _iter != _hfun.
+                _euclidean_mesh_2d._mesh._set1.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() < +0) continue ;
+                    
+                    if (_ipos < _hmsh._value._size)
+                    _hmsh._value.
+                        _data[_ipos++] = _iter->hval() ;
+                }
+            }
+            else
+            if (_hfun._ndim == +3 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_mesh)
+            {
+                std::size_t _ipos = +0 ;
+                for (auto _iter  = _hfun.
+                _euclidean_mesh_3d._mesh._set1.head();
+                          _iter != _hfun.
+                _euclidean_mesh_3d._mesh._set1.tend();
+                        ++_iter  )
+                {
+                    if (_iter->mark() < +0) continue ;
+                    
+                    if (_ipos < _hmsh._value._size)
+                    _hmsh._value.
+                        _data[_ipos++] = _iter->hval() ;
+                }
+            }
+            else
+            if (_hfun._ndim == +2 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_grid)
+            {
+                std::size_t _ipos = +0 ;
+                for (auto _iter  = _hfun.
+                _euclidean_grid_2d._hmat.head();
+                          _iter != _hfun.
+                _euclidean_grid_2d._hmat.tend();
+                        ++_iter  )
+                {
+                    if (_ipos < _hmsh._value._size)
+                    _hmsh._value.
+                        _data[_ipos++] = *_iter ;
+                }
+            }
+            else
+            if (_hfun._ndim == +3 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_grid)
+            {
+                std::size_t _ipos = +0 ;
+                for (auto _iter  = _hfun.
+                _euclidean_grid_3d._hmat.head();
+                          _iter != _hfun.
+                _euclidean_grid_3d._hmat.tend();
+                        ++_iter  )
+                {
+                    if (_ipos < _hmsh._value._size)
+                    _hmsh._value.
+                        _data[_ipos++] = *_iter ;
+                }
+            }
+            else
+            if (_hfun._kind ==
+                jmsh_kind::ellipsoid_grid)
+            {
+                std::size_t _ipos = +0 ;
+                for (auto _iter  = _hfun.
+                _ellipsoid_grid_3d._hmat.head();
+                          _iter != _hfun.
+                _ellipsoid_grid_3d._hmat.tend();
+                        ++_iter  )
+                {
+                    if (_ipos < _hmsh._value._size)
+                    _hmsh._value.
+                        _data[_ipos++] = *_iter ;
+                }
+            }
+        }
+        catch (...)
+        {
+            _errv = __unknown_error ;
+        }
+
+        return ( _errv ) ;
+    }
+
 
 #   endif   //__MSH_SAVE__
 
@@ -0,0 +1,180 @@
+
+//  gcc -Wall test_6.c -pthread
+//  -Xlinker -rpath=../lib/LNX-64
+//  -L ../lib/LNX-64 -ljigsaw64r -o test_6
+
+#   include "../inc/lib_jigsaw.h"
+
+#   include "stdio.h"
+#   include "pthread.h"
+
+#   define NUM_CALL 4
+
+    jigsaw_VERT2_t _vert2[4] = {        // setup geom.
+        { {0., 0.}, +0 } ,
+        { {1., 0.}, +0 } ,
+        { {1., 1.}, +0 } ,
+        { {0., 1.}, +0 }
+        } ;
+
+    jigsaw_EDGE2_t _edge2[4] = {
+        { {+0, +1}, +0 } ,
+        { {+1, +2}, +0 } ,
+        { {+2, +3}, +0 } ,
+        { {+3, +0}, +0 }
+        } ;
+
+    typedef struct
+        {
+        int             _retv ;
+        jigsaw_msh_t    _mesh ;
+        } call_data ;
+
+    /*
+    --------------------------------------------------------
+     * MAKE-MESH: one complete, independent JIGSAW call.
+    --------------------------------------------------------
+     */
+
+    void * make_mesh (
+        void        *_cptr
+        )
+    {
+        call_data *_call = (call_data *) _cptr ;
+
+        jigsaw_jig_t _jjig ;
+        jigsaw_msh_t _geom ;
+
+        jigsaw_init_jig_t(&_jjig) ;
+        jigsaw_init_msh_t(&_geom) ;
+        jigsaw_init_msh_t(&_call->_mesh) ;
+
+        _geom._flags
+            = JIGSAW_EUCLIDEAN_MESH;
+
+        _geom._vert2._data = &_vert2[0] ;
+        _geom._vert2._size = +4 ;
+
+        _geom._edge2._data = &_edge2[0] ;
+        _geom._edge2._size = +4 ;
+
+        _jjig._verbosity =   +0 ;
+
+        _jjig._hfun_hmax = 0.02 ;
+        _jjig._hfun_scal =
+            JIGSAW_HFUN_RELATIVE;
+
+        _jjig._mesh_dims =   +2 ;
+
+        _call->_retv = jigsaw (
+            &_jjig, // the config. opts
+            &_geom, // geom. data
+              NULL, // empty init. data
+              NULL, // empty hfun. data
+            &_call->_mesh) ;
+
+        return NULL ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * SAME-MESH: TRUE if two outputs are identical.
+    --------------------------------------------------------
+     */
+
+    int same_mesh (
+        jigsaw_msh_t *_mesh ,
+        jigsaw_msh_t *_same
+        )
+    {
+        if (_mesh->_vert2._size !=
+            _same->_vert2._size ) return 0 ;
+        if (_mesh->_tria3._size !=
+            _same->_tria3._size ) return 0 ;
+
+        for (indx_t _ipos = +0;
+                _ipos != _mesh->_vert2._size ;
+                   ++_ipos )
+        {
+            if (_mesh->_vert2._data[_ipos]._ppos[0] !=
+                _same->_vert2._data[_ipos]._ppos[0] ||
+                _mesh->_vert2._data[_ipos]._ppos[1] !=
+                _same->_vert2._data[_ipos]._ppos[1] )
+                return 0 ;
+        }
+
+        for (indx_t _ipos = +0;
+                _ipos != _mesh->_tria3._size ;
+                   ++_ipos )
+        {
+            if (_mesh->_tria3._data[_ipos]._node[0] !=
+                _same->_tria3._data[_ipos]._node[0] ||
+                _mesh->_tria3._data[_ipos]._node[1] !=
+                _same->_tria3._data[_ipos]._node[1] ||
+                _mesh->_tria3._data[_ipos]._node[2] !=
+                _same->_tria3._data[_ipos]._node[2] )
+                return 0 ;
+        }
+
+        return 1 ;
+    }
+
+    int main (
+        int          _argc ,
+        char       **_argv
+        )
+    {
+        int _retv = 0;
+
+        call_data _base, _call[NUM_CALL] ;
+        pthread_t _work[NUM_CALL] ;
+
+    /*-------------------------------- a serial reference */
+        make_mesh(&_base) ;
+
+        _retv = _base._retv ;
+
+    /*-------------------------------- concurrent, as per
+                                       a multi-user app. */
+        for (int _iter = +0;
+                _iter != NUM_CALL; ++_iter)
+        {
+            pthread_create(&_work[_iter],
+                NULL, make_mesh, &_call[_iter]) ;
+        }
+
+        for (int _iter = +0;
+                _iter != NUM_CALL; ++_iter)
+        {
+            pthread_join  ( _work[_iter], NULL) ;
+
+            if (_retv == +0)
+                _retv = _call[_iter]._retv ;
+
+            if (_retv == +0 &&
+               !same_mesh(&_base._mesh,
+                          &_call[_iter]._mesh))
+                _retv = -1 ;
+        }
+
+        printf (
+    "JIGSAW made %d tria. per call \n",
+            (int)_base._mesh._tria3._size) ;
+
+        jigsaw_free_msh_t(&_base._mesh) ;
+
+        for (int _iter = +0;
+                _iter != NUM_CALL; ++_iter)
+        {
+            jigsaw_free_msh_t(
+                &_call[_iter]._mesh) ;
+        }
+
+        printf (
+    "JIGSAW returned code: %d \n", _retv) ;
+
+        return _retv ;
+    }
+
+
+
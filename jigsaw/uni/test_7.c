@@ -0,0 +1,199 @@
+
+//  gcc -Wall test_7.c
+//  -Xlinker -rpath=../lib/LNX-64
+//  -L ../lib/LNX-64 -ljigsaw64r -o test_7
+
+#   include "../inc/lib_jigsaw.h"
+
+#   include "stdio.h"
+#   include "string.h"
+
+    jigsaw_VERT2_t _vert2[4] = {        // setup geom.
+        { {0., 0.}, +0 } ,
+        { {1., 0.}, +0 } ,
+        { {1., 1.}, +0 } ,
+        { {0., 1.}, +1 }
+        } ;
+
+    jigsaw_EDGE2_t _edge2[4] = {
+        { {+0, +1}, +0 } ,
+        { {+1, +2}, +0 } ,
+        { {+2, +3}, +1 } ,
+        { {+3, +0}, +1 }
+        } ;
+
+    /*
+    --------------------------------------------------------
+     * PUSH-SECT: section head, padded so that row data is
+     * 8-byte aligned within the file.
+    --------------------------------------------------------
+     */
+
+    void push_sect (
+        FILE        *_ffid ,
+        char const  *_line
+        )
+    {
+        long _fpos = ftell(_ffid) +
+            (long)strlen(_line) + 1 ;
+
+        fprintf(_ffid, "%s", _line) ;
+
+        for ( ; _fpos % 8 != 0; ++_fpos)
+            fprintf(_ffid, " ") ;
+
+        fprintf(_ffid, "\n") ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * SAVE-GEOM: write geom. as ASCII or BINARY *.MSH.
+    --------------------------------------------------------
+     */
+
+    int save_geom (
+        char const  *_file ,
+        int          _fbin
+        )
+    {
+        FILE *_ffid = fopen(_file, "wb") ;
+        if (_ffid == NULL) return -1 ;
+
+        fprintf(_ffid, "# %s\n", _file) ;
+
+        if (_fbin)
+        {
+    /*-------------------------------- raw, LE rows, v3 */
+        fprintf(_ffid,
+            "MSHID=3;EUCLIDEAN-MESH;BINARY\n");
+        fprintf(_ffid, "NDIMS=2\n") ;
+
+        push_sect(_ffid, "POINT=4") ;
+
+        for (int _ipos = +0; _ipos != 4; ++_ipos)
+        {
+            int _zero = +0 ;
+            fwrite(_vert2[_ipos]._ppos,
+                sizeof(real_t), 2, _ffid) ;
+            fwrite(&_vert2[_ipos]._itag,
+                sizeof(indx_t), 1, _ffid) ;
+            fwrite(&_zero,
+                sizeof(indx_t), 1, _ffid) ;
+        }
+
+        push_sect(_ffid, "EDGE2=4") ;
+
+        fwrite(_edge2,
+            sizeof(jigsaw_EDGE2_t), 4, _ffid) ;
+        }
+        else
+        {
+    /*-------------------------------- ;-delimited ASCII */
+        fprintf(_ffid,
+            "MSHID=3;EUCLIDEAN-MESH\n") ;
+        fprintf(_ffid, "NDIMS=2\n") ;
+
+        fprintf(_ffid, "POINT=4\n") ;
+
+        for (int _ipos = +0; _ipos != 4; ++_ipos)
+        {
+            fprintf(_ffid, "%.17g;%.17g;%d\n",
+                _vert2[_ipos]._ppos[0],
+                _vert2[_ipos]._ppos[1],
+                _vert2[_ipos]._itag) ;
+        }
+
+        fprintf(_ffid, "EDGE2=4\n") ;
+
+        for (int _ipos = +0; _ipos != 4; ++_ipos)
+        {
+            fprintf(_ffid, "%d;%d;%d\n",
+                _edge2[_ipos]._node[0],
+                _edge2[_ipos]._node[1],
+                _edge2[_ipos]._itag) ;
+        }
+        }
+
+        fclose(_ffid) ;
+
+        return +0 ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * SAME-GEOM: TRUE if loaded geom. matches the input.
+    --------------------------------------------------------
+     */
+
+    int same_geom (
+        jigsaw_msh_t *_geom
+        )
+    {
+        if (_geom->_vert2._size != 4) return 0 ;
+        if (_geom->_edge2._size != 4) return 0 ;
+
+        for (int _ipos = +0; _ipos != 4; ++_ipos)
+        {
+            if (_geom->_vert2._data[_ipos]._ppos[0] !=
+                       _vert2[_ipos]._ppos[0] ||
+                _geom->_vert2._data[_ipos]._ppos[1] !=
+                       _vert2[_ipos]._ppos[1] ||
+                _geom->_vert2._data[_ipos]._itag    !=
+                       _vert2[_ipos]._itag )
+                return 0 ;
+
+            if (_geom->_edge2._data[_ipos]._node[0] !=
+                       _edge2[_ipos]._node[0] ||
+                _geom->_edge2._data[_ipos]._node[1] !=
+                       _edge2[_ipos]._node[1] ||
+                _geom->_edge2._data[_ipos]._itag    !=
+                       _edge2[_ipos]._itag )
+                return 0 ;
+        }
+
+        return 1 ;
+    }
+
+    int main (
+        int          _argc ,
+        char       **_argv
+        )
+    {
+        int _retv = 0;
+
+        char const *_name[2] = {
+            "test_7.msh", "test_7.mshb" } ;
+
+        for (int _fbin = +0; _fbin != 2; ++_fbin)
+        {
+            jigsaw_msh_t _geom ;
+            jigsaw_init_msh_t(&_geom) ;
+
+    /*-------------------------------- save, then reload */
+            if (_retv == +0)
+                _retv = save_geom(
+                    _name[_fbin], _fbin) ;
+
+            if (_retv == +0)
+                _retv = jigsaw_load_msh_t(
+                    (char *)_name[_fbin], &_geom) ;
+
+            if (_retv == +0 &&
+               !same_geom(&_geom)) _retv = -1 ;
+
+            printf (
+    "JIGSAW loaded %s: %d \n", _name[_fbin], _retv) ;
+
+            jigsaw_free_msh_t(&_geom) ;
+
+            remove(_name[_fbin]) ;
+        }
+
+        printf (
+    "JIGSAW returned code: %d \n", _retv) ;
+
+        return _retv ;
+    }
+
+
+
@@ -0,0 +1,126 @@
+
+//  gcc -Wall test_8.c -lm
+//  -Xlinker -rpath=../lib/LNX-64
+//  -L ../lib/LNX-64 -ljigsaw64r -o test_8
+
+#   include "../inc/lib_jigsaw.h"
+
+#   include "stdio.h"
+#   include "math.h"
+
+#   define NUM_GRID 11
+
+    int main (
+        int          _argc ,
+        char       **_argv
+        )
+    {
+        int _retv = 0;
+
+    /*-------------------------------- setup JIGSAW types */
+        jigsaw_jig_t _jjig ;
+        jigsaw_msh_t _hfun ;
+
+        jigsaw_init_jig_t(&_jjig) ;
+        jigsaw_init_msh_t(&_hfun) ;
+
+    /*
+    --------------------------------------------------------
+     * a uniform grid, with a "spike" at its centre:
+    --------------------------------------------------------
+     *
+     *  H(x) = 1.0 everywhere, except H(.5,.5) = .05, so
+     *  that a limit of |dh/dx| <= .2 must be spread out
+     *  from the centre node.
+     *
+    --------------------------------------------------------
+     */
+
+        real_t _xgrid[NUM_GRID] ;
+        real_t _ygrid[NUM_GRID] ;
+
+        real_t _value[NUM_GRID * NUM_GRID] ;
+        real_t _vinit[NUM_GRID * NUM_GRID] ;
+
+        real_t _hdel = 1. / (NUM_GRID - 1) ;
+        real_t _dhdx = .2 ;
+
+        for (int _ipos = +0; _ipos != NUM_GRID; ++_ipos)
+        {
+            _xgrid[_ipos] = _ipos * _hdel ;
+            _ygrid[_ipos] = _ipos * _hdel ;
+        }
+
+        for (int _ipos = +0;
+                _ipos != NUM_GRID * NUM_GRID; ++_ipos)
+        {
+            _value[_ipos] = 1. ;
+        }
+
+        _value[(NUM_GRID * NUM_GRID) / 2] = .05 ;
+
+        for (int _ipos = +0;
+                _ipos != NUM_GRID * NUM_GRID; ++_ipos)
+        {
+            _vinit[_ipos] = _value[_ipos] ;
+        }
+
+        _hfun._flags
+            = JIGSAW_EUCLIDEAN_GRID;
+
+        _hfun._xgrid._data = &_xgrid[0] ;
+        _hfun._xgrid._size = NUM_GRID ;
+
+        _hfun._ygrid._data = &_ygrid[0] ;
+        _hfun._ygrid._size = NUM_GRID ;
+
+        _hfun._value._data = &_value[0] ;
+        _hfun._value._size = NUM_GRID * NUM_GRID ;
+
+    /*-------------------------------- limit |dh/dx| grad */
+        _jjig._verbosity =   +0 ;
+        _jjig._hfun_dhdx = _dhdx ;
+
+        _retv = marche (
+            &_jjig ,                // the config. opts
+            &_hfun ) ;              // H(x) in-place
+
+    /*-------------------------------- check H(x) results */
+        real_t _rtol = 1.E-08 ;
+
+        for (int _jpos = +0; _jpos != NUM_GRID; ++_jpos)
+        for (int _ipos = +0; _ipos != NUM_GRID; ++_ipos)
+        {
+            if (_retv != +0) break ;
+
+            int _inod = _jpos * NUM_GRID + _ipos ;
+
+        /*-------------------- values are only decreased */
+            if (_value[_inod] >
+                _vinit[_inod] + _rtol) _retv = -1 ;
+
+        /*-------------------- |dh/dx| is bounded on edges */
+            if (_ipos + 1 < NUM_GRID &&
+                fabs(_value[_inod + 1] -
+                     _value[_inod + 0] ) >
+                _dhdx * _hdel + _rtol) _retv = -1 ;
+
+            if (_jpos + 1 < NUM_GRID &&
+                fabs(_value[_inod + NUM_GRID] -
+                     _value[_inod + 0] ) >
+                _dhdx * _hdel + _rtol) _retv = -1 ;
+        }
+
+    /*-------------------------------- the spike is kept! */
+        if (_retv == +0 &&
+            _value[(NUM_GRID * NUM_GRID) / 2] != .05)
+            _retv = -1 ;
+
+        printf (
+    "JIGSAW returned code: %d \n", _retv) ;
+
+        return _retv ;
+    }
+
+
+
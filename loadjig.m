@@ -79,6 +79,8 @@ function [opts] = loadjig(name)
             opts .hfun_hmax = str2double(tstr{2});
             case 'hfun_hmin'
             opts .hfun_hmin = str2double(tstr{2});
+            case 'hfun_dhdx'
+            opts .hfun_dhdx = str2double(tstr{2});
             
         %-------------------------------------- MESH options
             case 'mesh_file'
@@ -92,6 +94,9 @@ function [opts] = loadjig(name)
             case 'mesh_iter'
             opts .mesh_iter = str2double(tstr{2});
             
+            case 'mesh_bulk'
+            opts .mesh_bulk = str2double(tstr{2});
+            
             case 'mesh_dims'
             opts .mesh_dims = str2double(tstr{2});
             
@@ -0,0 +1,127 @@
+function [varargout] = marche(opts)
+%MARCHE an interface to JIGSAW's "fast-marching" gradient-
+%limiter MARCHE.
+%
+%   HFUN = MARCHE(OPTS);
+%
+%   Call the |dh/dx| limiter MARCHE using the config. opti-
+%   ons specified in the OPTS structure. The mesh-size fun-
+%   ction in OPTS.HFUN_FILE is modified in-place, such that 
+%   |GRAD(H)| <= OPTS.HFUN_DHDX throughout. See the SAVEMSH/
+%   LOADMSH routines for a description of the HFUN output 
+%   structure.
+%
+%   OPTS is a user-defined set of meshing options:
+%
+%   REQUIRED fields:
+%   ---------------
+%
+%   OPTS.HFUN_FILE - 'HFUNNAME.MSH', a string containing the 
+%       name of the mesh-size function file (is required at 
+%       input, and is overwritten on output). See SAVEMSH 
+%       for additional details regarding the creation of 
+%       *.MSH files. ELLIPSOID-GRID functions must include 
+%       HFUN.RADII, so that |dh/dx| is computed in the same
+%       units as HFUN.VALUE.
+%
+%   OPTS.JCFG_FILE - 'JCFGNAME.JIG', a string containing the 
+%       name of the cofig. file (will be created on output).
+%
+%   OPTIONAL fields (HFUN):
+%   ----------------------
+%
+%   OPTS.HFUN_DHDX - {default=+inf} max. gradient |dh/dx| 
+%       permitted in the mesh-size function. Values are 
+%       limited via a single-pass "fast-marching" solver for 
+%       the Eikonal equation |GRAD(H)| = DHDX.
+%
+%   OPTIONAL fields (MISC):
+%   ----------------------
+%
+%   OPTS.VERBOSITY - {default=0} verbosity of log-file gene-
+%       rated by JIGSAW. Set VERBOSITY >= 1 for more output.
+%
+%   See also LOADMSH, SAVEMSH, LIMGRAD
+%
+
+%-----------------------------------------------------------
+%   github.com/dengwirda/jigsaw-matlab
+%-----------------------------------------------------------
+%
+
+    jexename = '';
+
+    if ( isempty(opts))
+        error('MARCHE: insufficient inputs.');
+    end
+    
+    if (~isempty(opts) && ~isstruct(opts))
+        error('MARCHE: invalid input types.');
+    end
+        
+    savejig(opts.jcfg_file,opts);
+    
+    filename = mfilename('fullpath');
+    filepath = fileparts( filename );
+
+%---------------------------------- default to _debug binary
+    if (strcmp(jexename,''))
+    if (ispc())
+        jexename = [filepath, ...
+            '\jigsaw\bin\WIN-64\marche64d.exe'];
+    elseif (ismac ())
+        jexename = [filepath, ...
+            '/jigsaw/bin/MAC-64/marche64d'];
+    elseif (isunix())
+        jexename = [filepath, ...
+            '/jigsaw/bin/LNX-64/marche64d'];
+    end
+    end
+    
+    if (exist(jexename,'file')~=2), jexename=''; end
+    
+%---------------------------------- switch to release binary
+    if (strcmp(jexename,''))
+    if (ispc())
+        jexename = [filepath, ...
+            '\jigsaw\bin\WIN-64\marche64r.exe'];
+    elseif (ismac ())
+        jexename = [filepath, ...
+            '/jigsaw/bin/MAC-64/marche64r'];
+    elseif (isunix())
+        jexename = [filepath, ...
+            '/jigsaw/bin/LNX-64/marche64r'];
+    end
+    end
+  
+    if (exist(jexename,'file')~=2), jexename=''; end
+  
+%---------------------------- call JIGSAW and capture stdout
+    if (exist(jexename,'file')==2)
+ 
+   [status, result] = system( ...
+        [jexename,' ',opts.jcfg_file], '-echo');
+        
+%---------------------------- OCTAVE doesn't handle '-echo'!
+    if (exist('OCTAVE_VERSION', 'builtin') > 0)
+        fprintf(1, '%s', result) ;
+    end
+    
+    else
+%---------------------------- couldn't find JIGSAW's backend
+        error([ ...
+        'JIGSAW''s executable not found -- ', ...
+        'has JIGSAW been compiled from src?', ...
+            ] ) ;
+    end
+
+    if (nargout == +1)
+%---------------------------- read hfun if output requested!
+    varargout{1} = loadmsh (opts.hfun_file) ;
+    
+    end
+
+end
+
+
+
@@ -80,6 +80,8 @@ function savejig(name,opts)
         pushreal(ffid,opts.hfun_hmax,'HFUN_HMAX');
         case 'hfun_hmin'
         pushreal(ffid,opts.hfun_hmin,'HFUN_HMIN');
+        case 'hfun_dhdx'
+        pushreal(ffid,opts.hfun_dhdx,'HFUN_DHDX');
         
     %------------------------------------------ MESH options
         case 'mesh_file'
@@ -93,6 +95,9 @@ function savejig(name,opts)
         case 'mesh_iter'
         pushints(ffid,opts.mesh_iter,'MESH_ITER');
         
+        case 'mesh_bulk'
+        pushints(ffid,opts.mesh_bulk,'MESH_BULK');
+        
         case 'mesh_dims'
         pushints(ffid,opts.mesh_dims,'MESH_DIMS');
         